@@ -0,0 +1,155 @@
+extends Node3D
+
+# Timing harness for the per-body work done around each step, meaning `JoltSpace3D::_pre_step` and
+# `JoltSpace3D::call_queries`, with enough active bodies for the layout of the bodies to matter.
+#
+# Run with `godot --headless --path examples res://scenes/benchmarks/pre_step/pre_step.tscn`
+#
+# The timings are taken from the physics trace, so they only cover the scopes themselves. Run it
+# against builds from before and after a change to compare them.
+
+const BODY_COUNT := 50000
+const WARMUP_FRAMES := 60
+const MEASURED_FRAMES := 300
+const TRACE_PATH := "user://pre_step_trace.json"
+const MAX_BODIES_SETTING := "physics/jolt_3d/limits/max_bodies"
+const MEASURED_SCOPES: Array[String] = ["JoltSpace3D::_pre_step", "JoltSpace3D::call_queries"]
+
+var server: Object
+var shape := RID()
+var bodies := PackedInt64Array()
+
+func _ready():
+	server = Engine.get_singleton(&"JoltPhysicsServer3D")
+
+	if server == null:
+		_finish("JoltPhysicsServer3D is not available")
+		return
+
+	# The examples project raises this limit, but it can be overridden, and it only takes effect on
+	# startup, so we check it up front rather than failing to create some of the bodies
+	var max_bodies: int = ProjectSettings.get_setting(MAX_BODIES_SETTING)
+
+	if max_bodies < BODY_COUNT:
+		_finish("'%s' is %d, but this needs at least %d" % [
+			MAX_BODIES_SETTING,
+			max_bodies,
+			BODY_COUNT
+		])
+		return
+
+	shape = PhysicsServer3D.sphere_shape_create()
+	PhysicsServer3D.shape_set_data(shape, 0.25)
+
+	var side := ceili(pow(BODY_COUNT, 1.0 / 3.0))
+	var transforms := PackedFloat32Array()
+
+	# The bodies are spread out far enough to not touch each other, so that the step is dominated by
+	# visiting the bodies rather than by solving contacts between them
+	for i in range(BODY_COUNT):
+		var x := i % side
+		var y := (i / side) % side
+		var z := i / (side * side)
+
+		transforms.append_array(PackedFloat32Array([
+			1.0, 0.0, 0.0, x * 1.0,
+			0.0, 1.0, 0.0, y * 1.0 + 1000.0,
+			0.0, 0.0, 1.0, z * 1.0
+		]))
+
+	bodies = server.bodies_create_batch(
+		get_world_3d().space,
+		shape,
+		PhysicsServer3D.BODY_MODE_RIGID,
+		transforms,
+		1,
+		0
+	)
+
+	# Every body syncs its state and stays awake, so that all of them go through both scopes
+	var sync_callback := func(_state): pass
+
+	for id in bodies:
+		var body := rid_from_int64(id)
+		PhysicsServer3D.body_set_state(body, PhysicsServer3D.BODY_STATE_CAN_SLEEP, false)
+		PhysicsServer3D.body_set_state_sync_callback(body, sync_callback)
+
+	for i in range(WARMUP_FRAMES):
+		await get_tree().physics_frame
+
+	server.clear_trace()
+	server.set_tracing_enabled(true)
+
+	var start_usec := Time.get_ticks_usec()
+
+	for i in range(MEASURED_FRAMES):
+		await get_tree().physics_frame
+
+	var elapsed_usec := Time.get_ticks_usec() - start_usec
+
+	server.set_tracing_enabled(false)
+
+	var error: Error = server.dump_trace(TRACE_PATH)
+
+	if error != OK:
+		_finish("Failed to dump trace, with error '%s'" % error_string(error))
+		return
+
+	print("Stepped %d bodies for %d frames, averaging %.3f ms per frame" % [
+		BODY_COUNT,
+		MEASURED_FRAMES,
+		elapsed_usec / 1000.0 / MEASURED_FRAMES
+	])
+
+	_print_scope_timings()
+	_finish()
+
+func _print_scope_timings():
+	var trace = JSON.parse_string(FileAccess.get_file_as_string(TRACE_PATH))
+
+	if trace == null:
+		printerr("Failed to parse trace at '%s'" % TRACE_PATH)
+		return
+
+	var durations := {}
+
+	for scope in MEASURED_SCOPES:
+		durations[scope] = PackedFloat64Array()
+
+	for event in trace["traceEvents"]:
+		if durations.has(event["name"]):
+			durations[event["name"]].append(event["dur"])
+
+	for scope in MEASURED_SCOPES:
+		var samples: PackedFloat64Array = durations[scope]
+
+		if samples.is_empty():
+			printerr("No samples recorded for '%s'" % scope)
+			continue
+
+		samples.sort()
+
+		var total := 0.0
+
+		for sample in samples:
+			total += sample
+
+		print("%s: mean %.1f us, median %.1f us, min %.1f us (%d samples)" % [
+			scope,
+			total / samples.size(),
+			samples[samples.size() / 2],
+			samples[0],
+			samples.size()
+		])
+
+func _finish(error_message := ""):
+	for id in bodies:
+		PhysicsServer3D.free_rid(rid_from_int64(id))
+
+	if shape.is_valid():
+		PhysicsServer3D.free_rid(shape)
+
+	if not error_message.is_empty():
+		printerr("FAILED: %s" % error_message)
+
+	get_tree().quit(0 if error_message.is_empty() else 1)
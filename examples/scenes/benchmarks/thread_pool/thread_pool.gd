@@ -0,0 +1,155 @@
+extends Node3D
+
+# Benchmark for comparing the dedicated thread pool against Godot's `WorkerThreadPool`, by timing
+# the physics step of a large pile of boxes, which spreads a lot of small jobs across the threads.
+#
+# Run with `godot --headless --path examples res://scenes/benchmarks/thread_pool/thread_pool.tscn`
+#
+# "Use Dedicated Threads" only takes effect on startup, so run it once with the setting disabled
+# and once with it enabled (for example through an `override.cfg` in the project directory
+# containing `physics/jolt_3d/threading/use_dedicated_threads=true` under `[physics]`).
+
+const COLUMN_COUNT := 40
+const BOXES_PER_COLUMN := 10
+const WARMUP_FRAMES := 60
+const MEASURED_FRAMES := 300
+const TRACE_PATH := "user://thread_pool_trace.json"
+const DEDICATED_THREADS_SETTING := "physics/jolt_3d/threading/use_dedicated_threads"
+
+var server: Object
+var box_shape := RID()
+var floor_shape := RID()
+var floor_body := RID()
+var bodies := PackedInt64Array()
+
+func _ready():
+	server = Engine.get_singleton(&"JoltPhysicsServer3D")
+
+	if server == null:
+		_finish("JoltPhysicsServer3D is not available")
+		return
+
+	var space := get_world_3d().space
+
+	floor_shape = PhysicsServer3D.world_boundary_shape_create()
+	PhysicsServer3D.shape_set_data(floor_shape, Plane(Vector3.UP, 0.0))
+
+	floor_body = PhysicsServer3D.body_create()
+	PhysicsServer3D.body_set_mode(floor_body, PhysicsServer3D.BODY_MODE_STATIC)
+	PhysicsServer3D.body_add_shape(floor_body, floor_shape)
+	PhysicsServer3D.body_set_space(floor_body, space)
+
+	box_shape = PhysicsServer3D.box_shape_create()
+	PhysicsServer3D.shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5))
+
+	var transforms := PackedFloat32Array()
+
+	# The columns are placed right next to each other, so that they topple into one big pile that
+	# keeps generating contacts for the whole duration of the benchmark
+	for x in range(COLUMN_COUNT):
+		for z in range(COLUMN_COUNT):
+			for y in range(BOXES_PER_COLUMN):
+				transforms.append_array(PackedFloat32Array([
+					1.0, 0.0, 0.0, x * 1.05 + randf() * 0.1,
+					0.0, 1.0, 0.0, y * 1.1 + 0.5,
+					0.0, 0.0, 1.0, z * 1.05 + randf() * 0.1
+				]))
+
+	bodies = server.bodies_create_batch(
+		space,
+		box_shape,
+		PhysicsServer3D.BODY_MODE_RIGID,
+		transforms,
+		1,
+		1
+	)
+
+	for i in range(WARMUP_FRAMES):
+		await get_tree().physics_frame
+
+	server.clear_trace()
+	server.set_tracing_enabled(true)
+
+	for i in range(MEASURED_FRAMES):
+		await get_tree().physics_frame
+
+	server.set_tracing_enabled(false)
+
+	var error: Error = server.dump_trace(TRACE_PATH)
+
+	if error != OK:
+		_finish("Failed to dump trace, with error '%s'" % error_string(error))
+		return
+
+	_print_step_timings()
+	_finish()
+
+func _print_step_timings():
+	var trace = JSON.parse_string(FileAccess.get_file_as_string(TRACE_PATH))
+
+	if trace == null:
+		printerr("Failed to parse trace at '%s'" % TRACE_PATH)
+		return
+
+	var pre_steps := []
+	var post_steps := []
+
+	for event in trace["traceEvents"]:
+		if event["name"] == "JoltSpace3D::_pre_step":
+			pre_steps.append(event)
+		elif event["name"] == "JoltSpace3D::_post_step":
+			post_steps.append(event)
+
+	var sort_by_start := func(a, b): return a["ts"] < b["ts"]
+	pre_steps.sort_custom(sort_by_start)
+	post_steps.sort_custom(sort_by_start)
+
+	# Each step starts with the pre-step and ends with the post-step, with everything that Jolt runs
+	# on the thread pool happening in between. The oldest events might have been overwritten in the
+	# trace, so each post-step is paired with the closest pre-step that came before it.
+	var samples := PackedFloat64Array()
+	var pre_index := 0
+
+	for post_step in post_steps:
+		var step_start := -1.0
+
+		while pre_index < pre_steps.size() and pre_steps[pre_index]["ts"] <= post_step["ts"]:
+			step_start = pre_steps[pre_index]["ts"]
+			pre_index += 1
+
+		if step_start >= 0.0:
+			samples.append(post_step["ts"] + post_step["dur"] - step_start)
+
+	if samples.is_empty():
+		printerr("No steps recorded")
+		return
+
+	samples.sort()
+
+	var total := 0.0
+
+	for sample in samples:
+		total += sample
+
+	print("Stepped %d boxes with %s: mean %.1f us, median %.1f us, min %.1f us (%d steps)" % [
+		bodies.size(),
+		"dedicated threads" if ProjectSettings.get_setting(DEDICATED_THREADS_SETTING) \
+			else "WorkerThreadPool",
+		total / samples.size(),
+		samples[samples.size() / 2],
+		samples[0],
+		samples.size()
+	])
+
+func _finish(error_message := ""):
+	for id in bodies:
+		PhysicsServer3D.free_rid(rid_from_int64(id))
+
+	for rid in [floor_body, floor_shape, box_shape]:
+		if rid.is_valid():
+			PhysicsServer3D.free_rid(rid)
+
+	if not error_message.is_empty():
+		printerr("FAILED: %s" % error_message)
+
+	get_tree().quit(0 if error_message.is_empty() else 1)
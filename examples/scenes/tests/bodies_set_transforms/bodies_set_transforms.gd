@@ -0,0 +1,91 @@
+extends Node3D
+
+# Regression test for `bodies_set_transforms` on rigid bodies that are already in a space, which
+# used to deadlock in editor and debug builds, due to the body locks being taken twice.
+#
+# Run with `godot --headless --path examples res://scenes/tests/bodies_set_transforms/bodies_set_transforms.tscn`
+
+const BODY_COUNT := 64
+
+var server: Object
+var shape := RID()
+var bodies: Array[RID] = []
+
+func _ready():
+	server = Engine.get_singleton(&"JoltPhysicsServer3D")
+
+	if server == null:
+		_finish(false, "JoltPhysicsServer3D is not available")
+		return
+
+	shape = PhysicsServer3D.sphere_shape_create()
+	PhysicsServer3D.shape_set_data(shape, 0.5)
+
+	for i in range(BODY_COUNT):
+		var body := PhysicsServer3D.body_create()
+		PhysicsServer3D.body_set_mode(body, PhysicsServer3D.BODY_MODE_RIGID)
+		PhysicsServer3D.body_add_shape(body, shape)
+		PhysicsServer3D.body_set_space(body, get_world_3d().space)
+		PhysicsServer3D.body_set_state(
+			body,
+			PhysicsServer3D.BODY_STATE_TRANSFORM,
+			Transform3D(Basis(), Vector3(i * 2.0, 0.0, 0.0))
+		)
+		bodies.append(body)
+
+	# Let the bodies be added to the broad phase before moving them
+	await get_tree().physics_frame
+	await get_tree().physics_frame
+
+	var rids := PackedInt64Array()
+	var transforms := PackedFloat32Array()
+
+	for i in range(BODY_COUNT):
+		rids.append(bodies[i].get_id())
+		transforms.append_array(_pack_transform(_expected_transform(i)))
+
+	server.bodies_set_transforms(rids, transforms, false)
+
+	for i in range(BODY_COUNT):
+		var actual: Transform3D = PhysicsServer3D.body_get_state(
+			bodies[i],
+			PhysicsServer3D.BODY_STATE_TRANSFORM
+		)
+
+		if not actual.is_equal_approx(_expected_transform(i)):
+			_finish(false, "Body %d has transform %s, expected %s" % [
+				i,
+				actual,
+				_expected_transform(i)
+			])
+			return
+
+	_finish(true, "Moved %d rigid bodies" % BODY_COUNT)
+
+func _expected_transform(index: int) -> Transform3D:
+	var basis := Basis(Vector3.UP, index * 0.1)
+	return Transform3D(basis, Vector3(index * 2.0, 10.0, index * -2.0))
+
+func _pack_transform(transform: Transform3D) -> PackedFloat32Array:
+	var b := transform.basis
+	var o := transform.origin
+
+	return PackedFloat32Array([
+		b.x.x, b.y.x, b.z.x, o.x,
+		b.x.y, b.y.y, b.z.y, o.y,
+		b.x.z, b.y.z, b.z.z, o.z
+	])
+
+func _finish(passed: bool, message: String):
+	for body in bodies:
+		PhysicsServer3D.free_rid(body)
+
+	if shape.is_valid():
+		PhysicsServer3D.free_rid(shape)
+
+	if passed:
+		print("PASSED: %s" % message)
+	else:
+		printerr("FAILED: %s" % message)
+
+	get_tree().quit(0 if passed else 1)
@@ -116,6 +116,16 @@ public:
 		impl.insert(iter, std::move(p_val));
 	}
 
+	_FORCE_INLINE_ int32_t ordered_find(const TElement& p_value) const {
+		auto found = std::lower_bound(begin(), end(), p_value);
+
+		if (found != end() && !(p_value < *found)) {
+			return (int32_t)std::distance(begin(), found);
+		}
+
+		return -1;
+	}
+
 	_FORCE_INLINE_ int32_t find(const TElement& p_value, int32_t p_from = 0) const {
 		if (p_from < size()) {
 			auto found = std::find(begin() + p_from, end(), p_value);
@@ -27,11 +27,15 @@ public:
 		return UtilityFunctions::rid_from_int64(id);
 	}
 
-	_FORCE_INLINE_ TResource* get_or_null(const RID& p_rid) const {
-		auto iter = ptrs_by_id.find(p_rid.get_id());
+	_FORCE_INLINE_ TResource* get_or_null(int64_t p_id) const {
+		auto iter = ptrs_by_id.find(p_id);
 		return iter != ptrs_by_id.end() ? iter->second : nullptr;
 	}
 
+	_FORCE_INLINE_ TResource* get_or_null(const RID& p_rid) const {
+		return get_or_null(p_rid.get_id());
+	}
+
 	_FORCE_INLINE_ void replace(const RID& p_rid, TResource* p_new_ptr) {
 		auto iter = ptrs_by_id.find(p_rid.get_id());
 		ERR_FAIL_COND(iter == ptrs_by_id.end());
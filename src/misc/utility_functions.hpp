@@ -60,3 +60,41 @@ _FORCE_INLINE_ double estimate_physics_step() {
 
 	return step_scaled;
 }
+
+// Packed transforms are laid out the same way as in `MultiMesh`, meaning the rows of the basis with
+// the origin appended to each of them.
+constexpr int32_t PACKED_TRANSFORM_SIZE = 12;
+
+_FORCE_INLINE_ Transform3D unpack_transform(const float* p_data) {
+	return {
+		p_data[0],
+		p_data[1],
+		p_data[2],
+		p_data[4],
+		p_data[5],
+		p_data[6],
+		p_data[8],
+		p_data[9],
+		p_data[10],
+		p_data[3],
+		p_data[7],
+		p_data[11]};
+}
+
+_FORCE_INLINE_ void pack_transform(const Transform3D& p_transform, float* p_data) {
+	const Basis& b = p_transform.basis;
+	const Vector3& o = p_transform.origin;
+
+	p_data[0] = b[0][0];
+	p_data[1] = b[0][1];
+	p_data[2] = b[0][2];
+	p_data[3] = o.x;
+	p_data[4] = b[1][0];
+	p_data[5] = b[1][1];
+	p_data[6] = b[1][2];
+	p_data[7] = o.y;
+	p_data[8] = b[2][0];
+	p_data[9] = b[2][1];
+	p_data[10] = b[2][2];
+	p_data[11] = o.z;
+}
@@ -154,7 +154,28 @@ void JoltAreaImpl3D::set_body_monitor_callback(const Callable& p_callback) {
 
 	body_monitor_callback = p_callback;
 
-	_body_monitoring_changed();
+	// The batch callback takes precedence, in which case this one doesn't receive any events
+	if (!body_monitor_batch_callback.is_valid()) {
+		_body_monitoring_changed();
+	}
+}
+
+void JoltAreaImpl3D::set_body_monitor_batch_callback(const Callable& p_callback) {
+	if (p_callback == body_monitor_batch_callback) {
+		return;
+	}
+
+	const Callable old_batch_callback = body_monitor_batch_callback;
+
+	body_monitor_batch_callback = p_callback;
+
+	// When this hands the events over to or from the regular callback, the one that stops receiving
+	// them needs to see everything exit, whereas anything else works the same as the regular one
+	if (old_batch_callback.is_valid() != p_callback.is_valid() && body_monitor_callback.is_valid()) {
+		_monitor_receiver_swapped(bodies_by_id, body_monitor_callback, old_batch_callback);
+	} else {
+		_body_monitoring_changed();
+	}
 }
 
 void JoltAreaImpl3D::set_area_monitor_callback(const Callable& p_callback) {
@@ -164,7 +185,28 @@ void JoltAreaImpl3D::set_area_monitor_callback(const Callable& p_callback) {
 
 	area_monitor_callback = p_callback;
 
-	_area_monitoring_changed();
+	// The batch callback takes precedence, in which case this one doesn't receive any events
+	if (!area_monitor_batch_callback.is_valid()) {
+		_area_monitoring_changed();
+	}
+}
+
+void JoltAreaImpl3D::set_area_monitor_batch_callback(const Callable& p_callback) {
+	if (p_callback == area_monitor_batch_callback) {
+		return;
+	}
+
+	const Callable old_batch_callback = area_monitor_batch_callback;
+
+	area_monitor_batch_callback = p_callback;
+
+	// When this hands the events over to or from the regular callback, the one that stops receiving
+	// them needs to see everything exit, whereas anything else works the same as the regular one
+	if (old_batch_callback.is_valid() != p_callback.is_valid() && area_monitor_callback.is_valid()) {
+		_monitor_receiver_swapped(areas_by_id, area_monitor_callback, old_batch_callback);
+	} else {
+		_area_monitoring_changed();
+	}
 }
 
 void JoltAreaImpl3D::set_monitorable(bool p_monitorable, bool p_lock) {
@@ -193,13 +235,20 @@ bool JoltAreaImpl3D::can_interact_with(const JoltAreaImpl3D& p_other) const {
 	return can_monitor(p_other) || p_other.can_monitor(*this);
 }
 
-Vector3 JoltAreaImpl3D::compute_gravity(const Vector3& p_position, bool p_lock) const {
+void JoltAreaImpl3D::cache_gravity(bool p_lock) {
+	if (point_gravity) {
+		cached_gravity_point = get_transform_scaled(p_lock).xform(gravity_vector);
+	} else {
+		cached_gravity = gravity_vector * gravity;
+	}
+}
+
+Vector3 JoltAreaImpl3D::compute_gravity(const Vector3& p_position) const {
 	if (!point_gravity) {
-		return gravity_vector * gravity;
+		return cached_gravity;
 	}
 
-	const Vector3 point = get_transform_scaled(p_lock).xform(gravity_vector);
-	const Vector3 to_point = point - p_position;
+	const Vector3 to_point = cached_gravity_point - p_position;
 	const float to_point_dist_sq = max(to_point.length_squared(), CMP_EPSILON);
 	const Vector3 to_point_dir = to_point / Math::sqrt(to_point_dist_sq);
 
@@ -276,8 +325,17 @@ bool JoltAreaImpl3D::shape_exited(
 }
 
 void JoltAreaImpl3D::call_queries([[maybe_unused]] JPH::Body& p_jolt_body) {
-	_flush_events(bodies_by_id, body_monitor_callback);
-	_flush_events(areas_by_id, area_monitor_callback);
+	// Any receivers that were replaced get their events first, since they were reported before the
+	// ones that are now pending for their replacements
+	LocalVector<RetiredReceiver> receivers = std::move(retired_receivers);
+	retired_receivers.clear();
+
+	for (RetiredReceiver& receiver : receivers) {
+		_flush_events(receiver.overlaps, receiver.callback, receiver.batch_callback);
+	}
+
+	_flush_events(bodies_by_id, body_monitor_callback, body_monitor_batch_callback);
+	_flush_events(areas_by_id, area_monitor_callback, area_monitor_batch_callback);
 }
 
 JPH::BroadPhaseLayer JoltAreaImpl3D::_get_broad_phase_layer() const {
@@ -318,6 +376,8 @@ void JoltAreaImpl3D::_add_shape_pair(
 	shape_indices.self = find_shape_index(p_self_shape_id);
 
 	p_overlap.pending_added.push_back(shape_indices);
+
+	space->enqueue_call_queries(this);
 }
 
 bool JoltAreaImpl3D::_remove_shape_pair(
@@ -334,14 +394,25 @@ bool JoltAreaImpl3D::_remove_shape_pair(
 	p_overlap.pending_removed.push_back(shape_pair->second);
 	p_overlap.shape_pairs.remove(shape_pair);
 
+	space->enqueue_call_queries(this);
+
 	return true;
 }
 
-void JoltAreaImpl3D::_flush_events(OverlapsById& p_objects, const Callable& p_callback) {
+void JoltAreaImpl3D::_flush_events(
+	OverlapsById& p_objects,
+	const Callable& p_callback,
+	const Callable& p_batch_callback
+) {
+	// The batch callback takes precedence, in which case all events get reported in one go
+	if (p_batch_callback.is_valid()) {
+		_report_events(p_objects, p_batch_callback);
+	}
+
 	p_objects.erase_if([&](auto& p_pair) {
 		auto& [id, overlap] = p_pair;
 
-		if (p_callback.is_valid()) {
+		if (p_callback.is_valid() && !p_batch_callback.is_valid()) {
 			for (auto& shape_indices : overlap.pending_removed) {
 				_report_event(
 					p_callback,
@@ -397,6 +468,67 @@ void JoltAreaImpl3D::_report_event(
 	p_callback.callv(arguments);
 }
 
+void JoltAreaImpl3D::_report_events(
+	const OverlapsById& p_objects,
+	const Callable& p_batch_callback
+) const {
+	int32_t event_count = 0;
+
+	for (const auto& [id, overlap] : p_objects) {
+		event_count += (int32_t)overlap.pending_removed.size();
+		event_count += (int32_t)overlap.pending_added.size();
+	}
+
+	if (event_count == 0) {
+		return;
+	}
+
+	PackedInt32Array statuses;
+	PackedInt64Array rids;
+	PackedInt64Array instance_ids;
+	PackedInt32Array other_shapes;
+	PackedInt32Array self_shapes;
+
+	statuses.resize(event_count);
+	rids.resize(event_count);
+	instance_ids.resize(event_count);
+	other_shapes.resize(event_count);
+	self_shapes.resize(event_count);
+
+	int32_t* statuses_ptr = statuses.ptrw();
+	int64_t* rids_ptr = rids.ptrw();
+	int64_t* instance_ids_ptr = instance_ids.ptrw();
+	int32_t* other_shapes_ptr = other_shapes.ptrw();
+	int32_t* self_shapes_ptr = self_shapes.ptrw();
+
+	int32_t index = 0;
+
+	auto write_event = [&](const Overlap& p_overlap, int32_t p_status, ShapeIndexPair p_pair) {
+		statuses_ptr[index] = p_status;
+		rids_ptr[index] = p_overlap.rid.get_id();
+		instance_ids_ptr[index] = (int64_t)(uint64_t)p_overlap.instance_id;
+		other_shapes_ptr[index] = p_pair.other;
+		self_shapes_ptr[index] = p_pair.self;
+		++index;
+	};
+
+	// All removals are written before any additions, so that a shape being removed and added again
+	// within the same step ends up being reported in the right order
+	for (const auto& [id, overlap] : p_objects) {
+		for (const ShapeIndexPair& shape_indices : overlap.pending_removed) {
+			write_event(overlap, PhysicsServer3D::AREA_BODY_REMOVED, shape_indices);
+		}
+	}
+
+	for (const auto& [id, overlap] : p_objects) {
+		for (const ShapeIndexPair& shape_indices : overlap.pending_added) {
+			write_event(overlap, PhysicsServer3D::AREA_BODY_ADDED, shape_indices);
+		}
+	}
+
+	p_batch_callback.call(statuses, rids, instance_ids, other_shapes, self_shapes);
+}
+
 void JoltAreaImpl3D::_notify_body_entered(const JPH::BodyID& p_body_id, bool p_lock) {
 	const JoltReadableBody3D jolt_body = space->read_body(p_body_id, p_lock);
 
@@ -421,6 +553,8 @@ void JoltAreaImpl3D::_force_bodies_entered() {
 			body.pending_added.push_back(index_pair);
 		}
 	}
+
+	_events_changed();
 }
 
 void JoltAreaImpl3D::_force_bodies_exited(bool p_remove, bool p_lock) {
@@ -434,6 +568,8 @@ void JoltAreaImpl3D::_force_bodies_exited(bool p_remove, bool p_lock) {
 			_notify_body_exited(id, p_lock);
 		}
 	}
+
+	_events_changed();
 }
 
 void JoltAreaImpl3D::_force_areas_entered() {
@@ -442,6 +578,8 @@ void JoltAreaImpl3D::_force_areas_entered() {
 			area.pending_added.push_back(index_pair);
 		}
 	}
+
+	_events_changed();
 }
 
 void JoltAreaImpl3D::_force_areas_exited(bool p_remove, [[maybe_unused]] bool p_lock) {
@@ -454,6 +592,14 @@ void JoltAreaImpl3D::_force_areas_exited(bool p_remove, [[maybe_unused]] bool p_
 			area.shape_pairs.clear();
 		}
 	}
+
+	_events_changed();
+}
+
+void JoltAreaImpl3D::_events_changed() {
+	if (space != nullptr) {
+		space->enqueue_call_queries(this);
+	}
 }
 
 void JoltAreaImpl3D::_update_group_filter(bool p_lock) {
@@ -469,6 +615,8 @@ void JoltAreaImpl3D::_update_group_filter(bool p_lock) {
 
 void JoltAreaImpl3D::_space_changing(bool p_lock) {
 	if (space != nullptr) {
+		space->remove_area(this);
+
 		// HACK(mihe): Ideally we would rely on our contact listener to report all the exits when we
 		// move between (or out of) spaces, but because our Jolt body is going to be destroyed when
 		// we leave this space the contact listener won't be able to retrieve the corresponding area
@@ -479,7 +627,53 @@ void JoltAreaImpl3D::_space_changing(bool p_lock) {
 }
 
 void JoltAreaImpl3D::_space_changed(bool p_lock) {
+	if (space != nullptr) {
+		space->add_area(this);
+	}
+
 	_update_group_filter(p_lock);
+	_events_changed();
+}
+
+void JoltAreaImpl3D::_monitor_receiver_swapped(
+	OverlapsById& p_objects,
+	const Callable& p_old_callback,
+	const Callable& p_old_batch_callback
+) {
+	if (space != nullptr) {
+		// Whatever is still pending was reported while the old receiver was in place, so it gets
+		// those first, followed by exits for everything that's currently overlapping
+		RetiredReceiver& pending = retired_receivers.emplace_back();
+		pending.overlaps = p_objects;
+		pending.callback = p_old_callback;
+		pending.batch_callback = p_old_batch_callback;
+
+		RetiredReceiver& exits = retired_receivers.emplace_back();
+		exits.callback = p_old_callback;
+		exits.batch_callback = p_old_batch_callback;
+
+		for (const auto& [id, object] : p_objects) {
+			Overlap& overlap = exits.overlaps[id];
+			overlap.rid = object.rid;
+			overlap.instance_id = object.instance_id;
+
+			for (const auto& [id_pair, index_pair] : object.shape_pairs) {
+				overlap.pending_removed.push_back(index_pair);
+			}
+		}
+	}
+
+	// The new receiver then gets enters for everything that's currently overlapping
+	for (auto& [id, object] : p_objects) {
+		object.pending_removed.clear();
+		object.pending_added.clear();
+
+		for (const auto& [id_pair, index_pair] : object.shape_pairs) {
+			object.pending_added.push_back(index_pair);
+		}
+	}
+
+	_events_changed();
 }
 
 void JoltAreaImpl3D::_body_monitoring_changed() {
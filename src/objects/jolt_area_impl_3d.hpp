@@ -51,6 +51,14 @@ class JoltAreaImpl3D final : public JoltObjectImpl3D {
 
 	using OverlapsById = HashMap<JPH::BodyID, Overlap, BodyIDHasher>;
 
+	struct RetiredReceiver {
+		OverlapsById overlaps;
+
+		Callable callback;
+
+		Callable batch_callback;
+	};
+
 public:
 	using OverrideMode = PhysicsServer3D::AreaSpaceOverrideMode;
 
@@ -60,14 +68,22 @@ public:
 
 	void set_param(PhysicsServer3D::AreaParameter p_param, const Variant& p_value);
 
-	bool has_body_monitor_callback() const { return body_monitor_callback.is_valid(); }
+	bool has_body_monitor_callback() const {
+		return body_monitor_callback.is_valid() || body_monitor_batch_callback.is_valid();
+	}
 
 	void set_body_monitor_callback(const Callable& p_callback);
 
-	bool has_area_monitor_callback() const { return area_monitor_callback.is_valid(); }
+	void set_body_monitor_batch_callback(const Callable& p_callback);
+
+	bool has_area_monitor_callback() const {
+		return area_monitor_callback.is_valid() || area_monitor_batch_callback.is_valid();
+	}
 
 	void set_area_monitor_callback(const Callable& p_callback);
 
+	void set_area_monitor_batch_callback(const Callable& p_callback);
+
 	bool is_monitorable() const { return monitorable; }
 
 	void set_monitorable(bool p_monitorable, bool p_lock = true);
@@ -122,7 +138,9 @@ public:
 
 	void set_gravity_vector(const Vector3& p_vector) { gravity_vector = p_vector; }
 
-	Vector3 compute_gravity(const Vector3& p_position, bool p_lock = true) const;
+	void cache_gravity(bool p_lock = true);
+
+	Vector3 compute_gravity(const Vector3& p_position) const;
 
 	void body_shape_entered(
 		const JPH::BodyID& p_body_id,
@@ -180,7 +198,13 @@ private:
 		const JPH::SubShapeID& p_self_shape_id
 	);
 
-	void _flush_events(OverlapsById& p_objects, const Callable& p_callback);
+	void _flush_events(
+		OverlapsById& p_objects,
+		const Callable& p_callback,
+		const Callable& p_batch_callback
+	);
+
+	void _report_events(const OverlapsById& p_objects, const Callable& p_batch_callback) const;
 
 	void _report_event(
 		const Callable& p_callback,
@@ -203,12 +227,20 @@ private:
 
 	void _force_areas_exited(bool p_remove, bool p_lock = true);
 
+	void _events_changed();
+
 	void _update_group_filter(bool p_lock = true);
 
 	void _space_changing(bool p_lock = true) override;
 
 	void _space_changed(bool p_lock = true) override;
 
+	void _monitor_receiver_swapped(
+		OverlapsById& p_objects,
+		const Callable& p_old_callback,
+		const Callable& p_old_batch_callback
+	);
+
 	void _body_monitoring_changed();
 
 	void _area_monitoring_changed();
@@ -219,12 +251,22 @@ private:
 
 	OverlapsById areas_by_id;
 
+	LocalVector<RetiredReceiver> retired_receivers;
+
 	Vector3 gravity_vector = {0, -1, 0};
 
+	Vector3 cached_gravity;
+
+	Vector3 cached_gravity_point;
+
 	Callable body_monitor_callback;
 
 	Callable area_monitor_callback;
 
+	Callable body_monitor_batch_callback;
+
+	Callable area_monitor_batch_callback;
+
 	float priority = 0.0f;
 
 	float gravity = 9.8f;
@@ -47,6 +47,51 @@ JoltBodyImpl3D::~JoltBodyImpl3D() {
 	memdelete_safely(direct_state);
 }
 
+void JoltBodyImpl3D::recycle() {
+	// This puts the body back into its default state, while holding on to the memory it has
+	// already allocated for its various buffers. Note that reusing it still means creating a new
+	// Jolt body, RID and direct state, so this only cuts down on allocations rather than avoiding
+	// them altogether.
+	_reset_object();
+
+	// The direct state is not reused, since anyone still holding on to it would otherwise end up
+	// reading from whatever body this one gets reused as. Freeing it means they instead end up with
+	// a freed object, same as they would without pooling.
+	memdelete_safely(direct_state);
+
+	exceptions.clear();
+	contacts.clear();
+	areas.clear();
+	joints.clear();
+	custom_integration_userdata = Variant();
+	kinematic_transform = {};
+	inertia = {};
+	center_of_mass_custom = {};
+	constant_force = {};
+	constant_torque = {};
+	linear_surface_velocity = {};
+	angular_surface_velocity = {};
+	gravity = {};
+	body_state_callback = Callable();
+	custom_integration_callback = Callable();
+	mode = PhysicsServer3D::BODY_MODE_RIGID;
+	linear_damp_mode = PhysicsServer3D::BODY_DAMP_MODE_COMBINE;
+	angular_damp_mode = PhysicsServer3D::BODY_DAMP_MODE_COMBINE;
+	mass = 1.0f;
+	linear_damp = 0.0f;
+	angular_damp = 0.0f;
+	total_linear_damp = 0.0f;
+	total_angular_damp = 0.0f;
+	collision_priority = 1.0f;
+	contact_count = 0;
+	locked_axes = 0;
+	contact_fields = ~0U;
+	sync_state = false;
+	custom_center_of_mass = false;
+	custom_integrator = false;
+	batch_integrated = false;
+}
+
 Variant JoltBodyImpl3D::get_state(PhysicsServer3D::BodyState p_state) {
 	switch (p_state) {
 		case PhysicsServer3D::BODY_STATE_TRANSFORM: {
@@ -204,6 +249,14 @@ bool JoltBodyImpl3D::is_sleeping(bool p_lock) const {
 		return false;
 	}
 
+	if (parked) {
+		return true;
+	}
+
+	if (pending_add) {
+		return !pending_activation;
+	}
+
 	const JoltReadableBody3D body = space->read_body(jolt_id, p_lock);
 	ERR_FAIL_COND_D(body.is_invalid());
 
@@ -217,6 +270,17 @@ void JoltBodyImpl3D::set_is_sleeping(bool p_enabled, bool p_lock) {
 		return;
 	}
 
+	if (parked) {
+		// Parked bodies aren't part of the broad phase and can't be activated, so we leave it up to
+		// `set_parked` to activate the body once it's added back.
+		return;
+	}
+
+	if (pending_add) {
+		pending_activation = !p_enabled;
+		return;
+	}
+
 	JPH::BodyInterface& body_iface = space->get_body_iface(p_lock);
 
 	if (p_enabled) {
@@ -370,6 +434,14 @@ void JoltBodyImpl3D::set_center_of_mass_custom(const Vector3& p_center_of_mass,
 	_shapes_changed(p_lock);
 }
 
+void JoltBodyImpl3D::set_max_contacts_reported(int32_t p_count) {
+	contacts.resize(p_count);
+	contact_count = min(contact_count, p_count);
+
+	_update_stepping();
+	_update_contact_listening();
+}
+
 void JoltBodyImpl3D::add_contact(
 	const JoltBodyImpl3D* p_collider,
 	float p_depth,
@@ -604,7 +676,11 @@ void JoltBodyImpl3D::set_constant_torque(const Vector3& p_torque, bool p_lock) {
 }
 
 void JoltBodyImpl3D::add_collision_exception(const RID& p_excepted_body, bool p_lock) {
-	exceptions.push_back(p_excepted_body);
+	if (has_collision_exception(p_excepted_body)) {
+		return;
+	}
+
+	exceptions.ordered_insert(p_excepted_body);
 
 	_exceptions_changed(p_lock);
 }
@@ -616,7 +692,7 @@ void JoltBodyImpl3D::remove_collision_exception(const RID& p_excepted_body, bool
 }
 
 bool JoltBodyImpl3D::has_collision_exception(const RID& p_excepted_body) const {
-	return exceptions.find(p_excepted_body) >= 0;
+	return exceptions.ordered_find(p_excepted_body) >= 0;
 }
 
 TypedArray<RID> JoltBodyImpl3D::get_collision_exceptions() const {
@@ -966,8 +1042,20 @@ bool JoltBodyImpl3D::can_collide_with(const JoltBodyImpl3D& p_other) const {
 }
 
 bool JoltBodyImpl3D::can_interact_with(const JoltBodyImpl3D& p_other) const {
-	return (can_collide_with(p_other) || p_other.can_collide_with(*this)) &&
-		!has_collision_exception(p_other.get_rid()) && !p_other.has_collision_exception(rid);
+	if (!can_collide_with(p_other) && !p_other.can_collide_with(*this)) {
+		return false;
+	}
+
+	// Most bodies don't have any exceptions, so we check for that first to avoid the lookups
+	if (!exceptions.is_empty() && has_collision_exception(p_other.get_rid())) {
+		return false;
+	}
+
+	if (!p_other.exceptions.is_empty() && p_other.has_collision_exception(rid)) {
+		return false;
+	}
+
+	return true;
 }
 
 JPH::BroadPhaseLayer JoltBodyImpl3D::_get_broad_phase_layer() const {
@@ -1362,6 +1450,7 @@ void JoltBodyImpl3D::_mode_changed(bool p_lock) {
 	_update_object_layer(p_lock);
 	_update_kinematic_transform(p_lock);
 	_update_mass_properties(p_lock);
+	_update_stepping();
 	wake_up(p_lock);
 }
 
@@ -1395,6 +1484,14 @@ void JoltBodyImpl3D::_transform_changed(bool p_lock) {
 	wake_up(p_lock);
 }
 
+void JoltBodyImpl3D::_parked_changed(bool p_lock) {
+	if (parked) {
+		_destroy_joint_constraints();
+	} else {
+		_update_joint_constraints(p_lock);
+	}
+}
+
 void JoltBodyImpl3D::_motion_changed(bool p_lock) {
 	wake_up(p_lock);
 }
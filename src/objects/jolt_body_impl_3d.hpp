@@ -38,6 +38,8 @@ public:
 
 	~JoltBodyImpl3D() override;
 
+	void recycle();
+
 	Variant get_state(PhysicsServer3D::BodyState p_state);
 
 	void set_state(PhysicsServer3D::BodyState p_state, const Variant& p_value);
@@ -59,6 +61,10 @@ public:
 
 	bool has_custom_integrator() const { return custom_integrator; }
 
+	bool is_batch_integrated() const { return batch_integrated; }
+
+	void set_batch_integrated(bool p_enabled) { batch_integrated = p_enabled; }
+
 	void set_custom_integrator(bool p_enabled, bool p_lock = true);
 
 	bool is_sleeping(bool p_lock = true) const;
@@ -93,7 +99,7 @@ public:
 
 	int32_t get_max_contacts_reported() const { return contacts.size(); }
 
-	void set_max_contacts_reported(int32_t p_count) { contacts.resize(p_count); }
+	void set_max_contacts_reported(int32_t p_count);
 
 	int32_t get_contact_count() const { return contact_count; }
 
@@ -101,6 +107,10 @@ public:
 
 	bool generates_contacts() const override { return !contacts.is_empty(); }
 
+	uint32_t get_contact_fields() const { return contact_fields; }
+
+	void set_contact_fields(uint32_t p_fields) { contact_fields = p_fields; }
+
 	void add_contact(
 		const JoltBodyImpl3D* p_collider,
 		float p_depth,
@@ -162,6 +172,10 @@ public:
 
 	void remove_joint(JoltJointImpl3D* p_joint, bool p_lock = true);
 
+	bool needs_call_queries() const {
+		return sync_state && (has_state_sync_callback() || has_custom_integration_callback());
+	}
+
 	void call_queries(JPH::Body& p_jolt_body);
 
 	void pre_step(float p_step, JPH::Body& p_jolt_body) override;
@@ -251,6 +265,8 @@ private:
 
 	void _create_in_space() override;
 
+	bool _needs_stepping() const override { return is_kinematic() || generates_contacts(); }
+
 	void _integrate_forces(float p_step, JPH::Body& p_jolt_body);
 
 	void _pre_step_static(float p_step, JPH::Body& p_jolt_body);
@@ -297,45 +313,64 @@ private:
 
 	void _transform_changed(bool p_lock = true) override;
 
+	void _parked_changed(bool p_lock = true) override;
+
 	void _motion_changed(bool p_lock = true);
 
 	void _exceptions_changed(bool p_lock = true);
 
 	void _axis_lock_changed(bool p_lock = true);
 
-	LocalVector<RID> exceptions;
+	// The members up until `kinematic_transform` are the ones read or written by `pre_step` and
+	// `call_queries`, so they're kept together ahead of the ones that are only touched when the
+	// body is configured through the server.
 
-	LocalVector<Contact> contacts;
+	Vector3 gravity;
 
-	LocalVector<JoltAreaImpl3D*> areas;
+	Vector3 constant_force;
 
-	LocalVector<JoltJointImpl3D*> joints;
+	Vector3 constant_torque;
 
-	Variant custom_integration_userdata;
+	PhysicsServer3D::BodyMode mode = PhysicsServer3D::BODY_MODE_RIGID;
 
-	Transform3D kinematic_transform;
+	int32_t contact_count = 0;
 
-	Vector3 inertia;
+	uint32_t locked_axes = 0;
 
-	Vector3 center_of_mass_custom;
+	uint32_t contact_fields = ~0U;
 
-	Vector3 constant_force;
+	bool sync_state = false;
 
-	Vector3 constant_torque;
+	bool custom_integrator = false;
 
-	Vector3 linear_surface_velocity;
+	bool batch_integrated = false;
 
-	Vector3 angular_surface_velocity;
+	LocalVector<JoltAreaImpl3D*> areas;
 
-	Vector3 gravity;
+	LocalVector<Contact> contacts;
+
+	JoltPhysicsDirectBodyState3D* direct_state = nullptr;
+
+	Transform3D kinematic_transform;
+
+	// Kept sorted, so that it can be binary searched from the group filter.
+	LocalVector<RID> exceptions;
+
+	LocalVector<JoltJointImpl3D*> joints;
 
 	Callable body_state_callback;
 
 	Callable custom_integration_callback;
 
-	JoltPhysicsDirectBodyState3D* direct_state = nullptr;
+	Variant custom_integration_userdata;
 
-	PhysicsServer3D::BodyMode mode = PhysicsServer3D::BODY_MODE_RIGID;
+	Vector3 inertia;
+
+	Vector3 center_of_mass_custom;
+
+	Vector3 linear_surface_velocity;
+
+	Vector3 angular_surface_velocity;
 
 	DampMode linear_damp_mode = PhysicsServer3D::BODY_DAMP_MODE_COMBINE;
 
@@ -353,13 +388,5 @@ private:
 
 	float collision_priority = 1.0f;
 
-	int32_t contact_count = 0;
-
-	uint32_t locked_axes = 0;
-
-	bool sync_state = false;
-
 	bool custom_center_of_mass = false;
-
-	bool custom_integrator = false;
 };
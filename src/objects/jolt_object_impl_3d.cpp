@@ -9,12 +9,7 @@
 
 JoltObjectImpl3D::JoltObjectImpl3D(ObjectType p_object_type)
 	: object_type(p_object_type) {
-	jolt_settings->mAllowSleeping = true;
-	jolt_settings->mFriction = 1.0f;
-	jolt_settings->mRestitution = 0.0f;
-	jolt_settings->mLinearDamping = 0.0f;
-	jolt_settings->mAngularDamping = 0.0f;
-	jolt_settings->mGravityFactor = 1.0f;
+	_init_jolt_settings();
 }
 
 JoltObjectImpl3D::~JoltObjectImpl3D() {
@@ -47,12 +42,28 @@ void JoltObjectImpl3D::set_space(JoltSpace3D* p_space, bool p_lock) {
 	_space_changing(p_lock);
 
 	if (space != nullptr) {
+		if (stepping) {
+			space->remove_stepping_object(this);
+			stepping = false;
+		}
+
+		if (previous_jolt_shape != nullptr) {
+			space->dequeue_shape_swap(this);
+			previous_jolt_shape = nullptr;
+		}
+
+		space->dequeue_call_queries(this);
+		space->stop_listening_for_contacts(this);
+
 		const JoltWritableBody3D body = space->write_body(jolt_id, p_lock);
 		ERR_FAIL_COND(body.is_invalid());
 
-		jolt_settings = new JPH::BodyCreationSettings(body->GetBodyCreationSettings());
+		*jolt_settings = body->GetBodyCreationSettings();
+
+		if (!parked) {
+			_remove_from_space(false);
+		}
 
-		_remove_from_space(false);
 		_destroy_in_space(false);
 	}
 
@@ -60,12 +71,42 @@ void JoltObjectImpl3D::set_space(JoltSpace3D* p_space, bool p_lock) {
 
 	if (space != nullptr) {
 		_create_in_space();
-		_add_to_space();
+
+		if (!parked) {
+			_add_to_space();
+		}
+
+		_update_stepping();
+		_update_contact_listening();
 	}
 
 	_space_changed(p_lock);
 }
 
+void JoltObjectImpl3D::set_parked(bool p_enabled, bool p_lock) {
+	if (p_enabled == parked) {
+		return;
+	}
+
+	parked = p_enabled;
+
+	// Parking only takes the body out of the broad phase, leaving the Jolt body itself intact, so
+	// that it can be brought back without having to create a new one.
+	if (space != nullptr) {
+		if (parked) {
+			space->dequeue_call_queries(this);
+			_remove_from_space(p_lock);
+		} else {
+			_add_to_space(p_lock);
+		}
+
+		_update_stepping();
+		_update_contact_listening();
+	}
+
+	_parked_changed(p_lock);
+}
+
 void JoltObjectImpl3D::set_collision_layer(uint32_t p_layer, bool p_lock) {
 	if (p_layer == collision_layer) {
 		return;
@@ -115,7 +156,7 @@ void JoltObjectImpl3D::set_transform(Transform3D p_transform, bool p_lock) {
 		_shapes_changed(p_lock);
 	}
 
-	_apply_transform(p_transform);
+	_apply_transform(p_transform, p_lock);
 
 	_transform_changed(p_lock);
 }
@@ -253,18 +294,25 @@ void JoltObjectImpl3D::build_shape(bool p_lock) {
 	const JoltWritableBody3D body = space->write_body(jolt_id, p_lock);
 	ERR_FAIL_COND(body.is_invalid());
 
-	previous_jolt_shape = jolt_shape;
-
-	jolt_shape = try_build_shape();
+	JPH::ShapeRefC new_shape = try_build_shape();
 
-	if (jolt_shape == nullptr) {
-		jolt_shape = new JoltCustomEmptyShape();
+	if (new_shape == nullptr) {
+		new_shape = new JoltCustomEmptyShape();
 	}
 
-	if (jolt_shape == previous_jolt_shape) {
+	if (new_shape == jolt_shape) {
 		return;
 	}
 
+	if (previous_jolt_shape == nullptr) {
+		// The previous shape is needed for resolving sub-shape IDs until the next step is over, at
+		// which point it's released in `post_step`.
+		space->enqueue_shape_swap(this);
+		previous_jolt_shape = jolt_shape;
+	}
+
+	jolt_shape = new_shape;
+
 	space->get_body_iface(false)
 		.SetShape(jolt_id, jolt_shape, false, JPH::EActivation::DontActivate);
 
@@ -403,14 +451,32 @@ void JoltObjectImpl3D::set_shape_disabled(int32_t p_index, bool p_disabled, bool
 	_shapes_changed(p_lock);
 }
 
-void JoltObjectImpl3D::_add_to_space(bool p_lock) {
+void JoltObjectImpl3D::_add_to_space([[maybe_unused]] bool p_lock) {
+	// This happens if we failed to create the Jolt body, in which case `_create_end` will already
+	// have reported an error, and there's nothing we can add
+	if (jolt_id.IsInvalid()) {
+		return;
+	}
+
 	// HACK(mihe): Since `BODY_STATE_TRANSFORM` will be set right after creation it's more or less
 	// impossible to have a body be sleeping when created, so we default to always starting out as
 	// active.
-	space->get_body_iface(p_lock).AddBody(jolt_id, JPH::EActivation::Activate);
+	pending_activation = true;
+
+	// Rather than adding the body to the broad phase right away we let the space add all the bodies
+	// created since the last step in one batch, which is much faster and leaves the broad phase in a
+	// better state than adding them one at a time.
+	pending_add = true;
+	space->enqueue_add(this);
 }
 
 void JoltObjectImpl3D::_remove_from_space(bool p_lock) {
+	if (pending_add) {
+		space->dequeue_add(this);
+		pending_add = false;
+		return;
+	}
+
 	space->get_body_iface(p_lock).RemoveBody(jolt_id);
 }
 
@@ -478,10 +544,6 @@ void JoltObjectImpl3D::_create_begin() {
 }
 
 JPH::Body* JoltObjectImpl3D::_create_end() {
-	ON_SCOPE_EXIT {
-		delete_safely(jolt_settings);
-	};
-
 	JPH::Body* body = space->get_body_iface(false).CreateBody(*jolt_settings);
 
 	ERR_FAIL_NULL_D_MSG(
@@ -510,6 +572,68 @@ void JoltObjectImpl3D::_update_object_layer(bool p_lock) {
 	space->get_body_iface(p_lock).SetObjectLayer(jolt_id, _get_object_layer());
 }
 
+void JoltObjectImpl3D::_update_stepping() {
+	if (space == nullptr) {
+		return;
+	}
+
+	const bool needs_stepping = !parked && _needs_stepping();
+
+	if (needs_stepping == stepping) {
+		return;
+	}
+
+	if (needs_stepping) {
+		space->add_stepping_object(this);
+	} else {
+		space->remove_stepping_object(this);
+	}
+
+	stepping = needs_stepping;
+}
+
+void JoltObjectImpl3D::_update_contact_listening() {
+	if (space == nullptr) {
+		return;
+	}
+
+	if (!parked && generates_contacts()) {
+		space->listen_for_contacts(this);
+	} else {
+		space->stop_listening_for_contacts(this);
+	}
+}
+
+void JoltObjectImpl3D::_init_jolt_settings() {
+	jolt_settings->mAllowSleeping = true;
+	jolt_settings->mFriction = 1.0f;
+	jolt_settings->mRestitution = 0.0f;
+	jolt_settings->mLinearDamping = 0.0f;
+	jolt_settings->mAngularDamping = 0.0f;
+	jolt_settings->mGravityFactor = 1.0f;
+}
+
+void JoltObjectImpl3D::_reset_object() {
+	ERR_FAIL_COND(space != nullptr);
+
+	shapes.clear();
+	scale = {1.0f, 1.0f, 1.0f};
+	rid = {};
+	instance_id = {};
+	jolt_shape = nullptr;
+	previous_jolt_shape = nullptr;
+	collision_layer = 1;
+	collision_mask = 1;
+	add_index = -1;
+	pickable = false;
+	parked = false;
+	pending_add = false;
+	pending_activation = false;
+
+	*jolt_settings = JPH::BodyCreationSettings();
+	_init_jolt_settings();
+}
+
 void JoltObjectImpl3D::_collision_layer_changed(bool p_lock) {
 	_update_object_layer(p_lock);
 }
@@ -99,6 +99,12 @@ public:
 
 	virtual bool generates_contacts() const = 0;
 
+	bool is_stepping() const { return stepping; }
+
+	bool is_parked() const { return parked; }
+
+	void set_parked(bool p_enabled, bool p_lock = true);
+
 	JPH::ShapeRefC try_build_shape();
 
 	void build_shape(bool p_lock = true);
@@ -154,6 +160,7 @@ public:
 
 protected:
 	friend class JoltShapeImpl3D;
+	friend class JoltSpace3D;
 
 	virtual JPH::BroadPhaseLayer _get_broad_phase_layer() const = 0;
 
@@ -163,6 +170,8 @@ protected:
 
 	virtual void _create_in_space() = 0;
 
+	virtual bool _needs_stepping() const { return generates_contacts(); }
+
 	virtual void _add_to_space(bool p_lock = true);
 
 	virtual void _remove_from_space(bool p_lock = true);
@@ -177,6 +186,14 @@ protected:
 
 	void _update_object_layer(bool p_lock = true);
 
+	void _update_stepping();
+
+	void _update_contact_listening();
+
+	void _init_jolt_settings();
+
+	void _reset_object();
+
 	virtual void _collision_layer_changed(bool p_lock = true);
 
 	virtual void _collision_mask_changed(bool p_lock = true);
@@ -191,6 +208,26 @@ protected:
 
 	virtual void _transform_changed([[maybe_unused]] bool p_lock = true) { }
 
+	virtual void _parked_changed([[maybe_unused]] bool p_lock = true) { }
+
+	// The members up until `shapes` are the ones touched while stepping the space, so they're kept
+	// together at the start of the object, in order to share as few cache lines as possible with
+	// everything else.
+
+	JoltSpace3D* space = nullptr;
+
+	JPH::BodyID jolt_id;
+
+	ObjectType object_type = OBJECT_TYPE_INVALID;
+
+	bool stepping = false;
+
+	bool query_queued = false;
+
+	bool parked = false;
+
+	JPH::ShapeRefC previous_jolt_shape;
+
 	LocalVector<JoltShapeInstance3D> shapes;
 
 	Vector3 scale = {1.0f, 1.0f, 1.0f};
@@ -199,21 +236,21 @@ protected:
 
 	ObjectID instance_id;
 
-	JoltSpace3D* space = nullptr;
-
+	// Outlives the Jolt body, so that moving between spaces doesn't need to allocate new settings.
 	JPH::BodyCreationSettings* jolt_settings = new JPH::BodyCreationSettings();
 
 	JPH::ShapeRefC jolt_shape;
 
-	JPH::ShapeRefC previous_jolt_shape;
-
-	JPH::BodyID jolt_id;
-
 	uint32_t collision_layer = 1;
 
 	uint32_t collision_mask = 1;
 
-	ObjectType object_type = OBJECT_TYPE_INVALID;
+	// Where in the space's queue of objects to add this object is, so it can be removed in O(1).
+	int32_t add_index = -1;
 
 	bool pickable = false;
+
+	bool pending_add = false;
+
+	bool pending_activation = false;
 };
@@ -106,5 +106,7 @@ public:
 	PhysicsDirectSpaceState3D* _get_space_state() override;
 
 private:
+	void _wait_for_step() const;
+
 	JoltBodyImpl3D* body = nullptr;
 };
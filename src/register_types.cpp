@@ -92,4 +92,34 @@ GDExtensionBool GDE_EXPORT godot_jolt_main(
 	return init_obj.init();
 }
 
+bool GDE_EXPORT godot_jolt_space_set_batch_integrator(
+	int64_t p_space,
+	JoltBatchIntegrator p_integrator,
+	void* p_userdata,
+	bool p_parallel
+) {
+	OS* os = OS::get_singleton();
+
+	ERR_FAIL_COND_V_MSG(
+		os->get_thread_caller_id() != os->get_main_thread_id(),
+		false,
+		"Failed to set batch integrator. It can only be set from the main thread."
+	);
+
+	auto* physics_server = Object::cast_to<JoltPhysicsServer3D>(PhysicsServer3D::get_singleton());
+
+	ERR_FAIL_NULL_V_MSG(
+		physics_server,
+		false,
+		"Failed to set batch integrator. Godot Jolt is not the active physics server."
+	);
+
+	const RID space = UtilityFunctions::rid_from_int64(p_space);
+	ERR_FAIL_NULL_V(physics_server->get_space(space), false);
+
+	physics_server->space_set_batch_integrator(space, p_integrator, p_userdata, p_parallel);
+
+	return true;
+}
+
 } // extern "C"
@@ -8,6 +8,8 @@
 #include "joints/jolt_slider_joint_impl_3d.hpp"
 #include "objects/jolt_area_impl_3d.hpp"
 #include "objects/jolt_body_impl_3d.hpp"
+#include "servers/jolt_project_settings.hpp"
+#include "servers/jolt_tracer.hpp"
 #include "shapes/jolt_box_shape_impl_3d.hpp"
 #include "shapes/jolt_capsule_shape_impl_3d.hpp"
 #include "shapes/jolt_concave_polygon_shape_impl_3d.hpp"
@@ -20,6 +22,31 @@
 #include "spaces/jolt_job_system.hpp"
 #include "spaces/jolt_physics_direct_space_state_3d.hpp"
 #include "spaces/jolt_space_3d.hpp"
+#include "spaces/jolt_temp_allocator.hpp"
+
+namespace {
+
+struct SpaceStepContext {
+	JoltSpace3D* const* spaces = nullptr;
+
+	std::atomic<int32_t> next_space = 0;
+
+	int32_t space_count = 0;
+
+	float step = 0.0f;
+};
+
+void step_spaces(void* p_user_data, [[maybe_unused]] uint32_t p_index) {
+	auto* context = static_cast<SpaceStepContext*>(p_user_data);
+
+	// Each task keeps stepping spaces until there are none left, which means that no more spaces
+	// are stepped at the same time than there are tasks
+	for (int32_t i = context->next_space++; i < context->space_count; i = context->next_space++) {
+		context->spaces[i]->step(context->step);
+	}
+}
+
+} // namespace
 
 void JoltPhysicsServer3D::_bind_methods() {
 #ifdef GDJ_CONFIG_EDITOR
@@ -28,6 +55,57 @@ void JoltPhysicsServer3D::_bind_methods() {
 	BIND_METHOD(JoltPhysicsServer3D, space_dump_debug_snapshot, "space", "dir");
 #endif // GDJ_CONFIG_EDITOR
 
+	BIND_METHOD(JoltPhysicsServer3D, is_tracing_enabled);
+	BIND_METHOD(JoltPhysicsServer3D, set_tracing_enabled, "enabled");
+
+	BIND_METHOD(JoltPhysicsServer3D, clear_trace);
+
+	BIND_METHOD(JoltPhysicsServer3D, dump_trace, "path");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_get_collision_steps, "space");
+	BIND_METHOD(JoltPhysicsServer3D, space_set_collision_steps, "space", "steps");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_get_temp_memory_stats, "space");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_get_active_body_states, "space");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_is_interpolation_enabled, "space");
+	BIND_METHOD(JoltPhysicsServer3D, space_set_interpolation_enabled, "space", "enabled");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_get_interpolated_transforms, "space", "alpha");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_is_contact_stream_enabled, "space");
+	BIND_METHOD(JoltPhysicsServer3D, space_set_contact_stream_enabled, "space", "enabled");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_get_contact_stream, "space");
+
+	BIND_METHOD(
+		JoltPhysicsServer3D,
+		bodies_create_batch,
+		"space",
+		"shape",
+		"mode",
+		"transforms",
+		"collision_layer",
+		"collision_mask"
+	);
+
+	BIND_METHOD(JoltPhysicsServer3D, area_set_body_monitor_batch_callback, "area", "callback");
+	BIND_METHOD(JoltPhysicsServer3D, area_set_area_monitor_batch_callback, "area", "callback");
+
+	BIND_METHOD(JoltPhysicsServer3D, body_is_batch_integrated, "body");
+	BIND_METHOD(JoltPhysicsServer3D, body_set_batch_integrated, "body", "enabled");
+
+	BIND_METHOD(JoltPhysicsServer3D, body_is_parked, "body");
+	BIND_METHOD(JoltPhysicsServer3D, body_set_parked, "body", "enabled");
+
+	BIND_METHOD(JoltPhysicsServer3D, body_get_contact_fields, "body");
+	BIND_METHOD(JoltPhysicsServer3D, body_set_contact_fields, "body", "fields");
+
+	BIND_METHOD(JoltPhysicsServer3D, bodies_set_transforms, "bodies", "transforms", "activate");
+
+	BIND_METHOD(JoltPhysicsServer3D, bodies_set_velocities, "bodies", "velocities", "activate");
+
 	BIND_METHOD(JoltPhysicsServer3D, joint_get_enabled, "joint");
 	BIND_METHOD(JoltPhysicsServer3D, joint_set_enabled, "joint", "enabled");
 
@@ -119,6 +197,9 @@ void JoltPhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(G6DOF_JOINT_FLAG_ENABLE_LINEAR_LIMIT_SPRING);
 	BIND_ENUM_CONSTANT(G6DOF_JOINT_FLAG_ENABLE_LINEAR_SPRING_FREQUENCY);
 	BIND_ENUM_CONSTANT(G6DOF_JOINT_FLAG_ENABLE_ANGULAR_SPRING_FREQUENCY);
+
+	BIND_ENUM_CONSTANT(BODY_CONTACT_FIELD_VELOCITIES);
+	BIND_ENUM_CONSTANT(BODY_CONTACT_FIELD_IMPULSES);
 }
 
 JoltPhysicsServer3D::JoltPhysicsServer3D() {
@@ -134,6 +215,10 @@ JoltPhysicsServer3D::JoltPhysicsServer3D() {
 }
 
 JoltPhysicsServer3D::~JoltPhysicsServer3D() {
+	for (JoltBodyImpl3D* body : body_pool) {
+		memdelete_safely(body);
+	}
+
 	Engine::get_singleton()->unregister_singleton(NAMEOF(JoltPhysicsServer3D));
 }
 
@@ -205,49 +290,49 @@ RID JoltPhysicsServer3D::_custom_shape_create() {
 }
 
 void JoltPhysicsServer3D::_shape_set_data(const RID& p_shape, const Variant& p_data) {
-	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL(shape);
 
 	shape->set_data(p_data);
 }
 
 void JoltPhysicsServer3D::_shape_set_custom_solver_bias(const RID& p_shape, double p_bias) {
-	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL(shape);
 
 	shape->set_solver_bias((float)p_bias);
 }
 
 PhysicsServer3D::ShapeType JoltPhysicsServer3D::_shape_get_type(const RID& p_shape) const {
-	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	const JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
 	return shape->get_type();
 }
 
 Variant JoltPhysicsServer3D::_shape_get_data(const RID& p_shape) const {
-	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	const JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
 	return shape->get_data();
 }
 
 void JoltPhysicsServer3D::_shape_set_margin(const RID& p_shape, double p_margin) {
-	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL(shape);
 
 	shape->set_margin((float)p_margin);
 }
 
 double JoltPhysicsServer3D::_shape_get_margin(const RID& p_shape) const {
-	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	const JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
 	return (double)shape->get_margin();
 }
 
 double JoltPhysicsServer3D::_shape_get_custom_solver_bias(const RID& p_shape) const {
-	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	const JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
 	return (double)shape->get_solver_bias();
@@ -259,7 +344,7 @@ RID JoltPhysicsServer3D::_space_create() {
 	space->set_rid(rid);
 
 	const RID default_area_rid = area_create();
-	JoltAreaImpl3D* default_area = area_owner.get_or_null(default_area_rid);
+	JoltAreaImpl3D* default_area = get_area(default_area_rid);
 	ERR_FAIL_NULL_D(default_area);
 	space->set_default_area(default_area);
 	default_area->set_space(space);
@@ -268,21 +353,23 @@ RID JoltPhysicsServer3D::_space_create() {
 }
 
 void JoltPhysicsServer3D::_space_set_active(const RID& p_space, bool p_active) {
-	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	JoltSpace3D* space = get_space(p_space);
 	ERR_FAIL_NULL(space);
 
-	if (p_active) {
-		active_spaces.insert(space);
-	} else {
+	const bool is_active = active_spaces.find(space) != -1;
+
+	if (p_active && !is_active) {
+		active_spaces.push_back(space);
+	} else if (!p_active && is_active) {
 		active_spaces.erase(space);
 	}
 }
 
 bool JoltPhysicsServer3D::_space_is_active(const RID& p_space) const {
-	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	JoltSpace3D* space = get_space(p_space);
 	ERR_FAIL_NULL_D(space);
 
-	return active_spaces.has(space);
+	return active_spaces.find(space) != -1;
 }
 
 void JoltPhysicsServer3D::_space_set_param(
@@ -290,21 +377,21 @@ void JoltPhysicsServer3D::_space_set_param(
 	SpaceParameter p_param,
 	double p_value
 ) {
-	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	JoltSpace3D* space = get_space(p_space);
 	ERR_FAIL_NULL(space);
 
 	space->set_param(p_param, p_value);
 }
 
 double JoltPhysicsServer3D::_space_get_param(const RID& p_space, SpaceParameter p_param) const {
-	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	const JoltSpace3D* space = get_space(p_space);
 	ERR_FAIL_NULL_D(space);
 
 	return space->get_param(p_param);
 }
 
 PhysicsDirectSpaceState3D* JoltPhysicsServer3D::_space_get_direct_state(const RID& p_space) {
-	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	JoltSpace3D* space = get_space(p_space);
 	ERR_FAIL_NULL_D(space);
 
 	return space->get_direct_state();
@@ -315,7 +402,7 @@ void JoltPhysicsServer3D::_space_set_debug_contacts(
 	[[maybe_unused]] int32_t p_max_contacts
 ) {
 #ifdef GDJ_CONFIG_EDITOR
-	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	JoltSpace3D* space = get_space(p_space);
 	ERR_FAIL_NULL(space);
 
 	space->set_max_debug_contacts(p_max_contacts);
@@ -325,7 +412,7 @@ void JoltPhysicsServer3D::_space_set_debug_contacts(
 PackedVector3Array JoltPhysicsServer3D::_space_get_contacts([[maybe_unused]] const RID& p_space
 ) const {
 #ifdef GDJ_CONFIG_EDITOR
-	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	JoltSpace3D* space = get_space(p_space);
 	ERR_FAIL_NULL_D(space);
 
 	return space->get_debug_contacts();
@@ -336,7 +423,7 @@ PackedVector3Array JoltPhysicsServer3D::_space_get_contacts([[maybe_unused]] con
 
 int32_t JoltPhysicsServer3D::_space_get_contact_count([[maybe_unused]] const RID& p_space) const {
 #ifdef GDJ_CONFIG_EDITOR
-	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	JoltSpace3D* space = get_space(p_space);
 	ERR_FAIL_NULL_D(space);
 
 	return space->get_debug_contact_count();
@@ -353,13 +440,13 @@ RID JoltPhysicsServer3D::_area_create() {
 }
 
 void JoltPhysicsServer3D::_area_set_space(const RID& p_area, const RID& p_space) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	JoltSpace3D* space = nullptr;
 
 	if (p_space.is_valid()) {
-		space = space_owner.get_or_null(p_space);
+		space = get_space(p_space);
 		ERR_FAIL_NULL(space);
 	}
 
@@ -367,7 +454,7 @@ void JoltPhysicsServer3D::_area_set_space(const RID& p_area, const RID& p_space)
 }
 
 RID JoltPhysicsServer3D::_area_get_space(const RID& p_area) const {
-	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	const JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL_D(area);
 
 	const JoltSpace3D* space = area->get_space();
@@ -385,10 +472,10 @@ void JoltPhysicsServer3D::_area_add_shape(
 	const Transform3D& p_transform,
 	bool p_disabled
 ) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
-	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL(shape);
 
 	area->add_shape(shape, p_transform, p_disabled);
@@ -399,10 +486,10 @@ void JoltPhysicsServer3D::_area_set_shape(
 	int32_t p_shape_idx,
 	const RID& p_shape
 ) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
-	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL(shape);
 
 	area->set_shape(p_shape_idx, shape);
@@ -413,21 +500,21 @@ void JoltPhysicsServer3D::_area_set_shape_transform(
 	int32_t p_shape_idx,
 	const Transform3D& p_transform
 ) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->set_shape_transform(p_shape_idx, p_transform);
 }
 
 int32_t JoltPhysicsServer3D::_area_get_shape_count(const RID& p_area) const {
-	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	const JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL_D(area);
 
 	return area->get_shape_count();
 }
 
 RID JoltPhysicsServer3D::_area_get_shape(const RID& p_area, int32_t p_shape_idx) const {
-	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	const JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL_D(area);
 
 	const JoltShapeImpl3D* shape = area->get_shape(p_shape_idx);
@@ -438,21 +525,21 @@ RID JoltPhysicsServer3D::_area_get_shape(const RID& p_area, int32_t p_shape_idx)
 
 Transform3D JoltPhysicsServer3D::_area_get_shape_transform(const RID& p_area, int32_t p_shape_idx)
 	const {
-	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	const JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL_D(area);
 
 	return area->get_shape_transform_scaled(p_shape_idx);
 }
 
 void JoltPhysicsServer3D::_area_remove_shape(const RID& p_area, int32_t p_shape_idx) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->remove_shape(p_shape_idx);
 }
 
 void JoltPhysicsServer3D::_area_clear_shapes(const RID& p_area) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->clear_shapes();
@@ -463,21 +550,21 @@ void JoltPhysicsServer3D::_area_set_shape_disabled(
 	int32_t p_shape_idx,
 	bool p_disabled
 ) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->set_shape_disabled(p_shape_idx, p_disabled);
 }
 
 void JoltPhysicsServer3D::_area_attach_object_instance_id(const RID& p_area, uint64_t p_id) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->set_instance_id(ObjectID(p_id));
 }
 
 uint64_t JoltPhysicsServer3D::_area_get_object_instance_id(const RID& p_area) const {
-	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	const JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL_D(area);
 
 	return area->get_instance_id();
@@ -491,67 +578,67 @@ void JoltPhysicsServer3D::_area_set_param(
 	RID area_rid = p_area;
 
 	if (space_owner.owns(area_rid)) {
-		const JoltSpace3D* space = space_owner.get_or_null(area_rid);
+		const JoltSpace3D* space = get_space(area_rid);
 		area_rid = space->get_default_area()->get_rid();
 	}
 
-	JoltAreaImpl3D* area = area_owner.get_or_null(area_rid);
+	JoltAreaImpl3D* area = get_area(area_rid);
 	ERR_FAIL_NULL(area);
 
 	area->set_param(p_param, p_value);
 }
 
 void JoltPhysicsServer3D::_area_set_transform(const RID& p_area, const Transform3D& p_transform) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	return area->set_transform(p_transform);
 }
 
 Variant JoltPhysicsServer3D::_area_get_param(const RID& p_area, AreaParameter p_param) const {
-	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	const JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL_D(area);
 
 	return area->get_param(p_param);
 }
 
 Transform3D JoltPhysicsServer3D::_area_get_transform(const RID& p_area) const {
-	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	const JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL_D(area);
 
 	return area->get_transform_scaled();
 }
 
 void JoltPhysicsServer3D::_area_set_collision_mask(const RID& p_area, uint32_t p_mask) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->set_collision_mask(p_mask);
 }
 
 uint32_t JoltPhysicsServer3D::_area_get_collision_mask(const RID& p_area) const {
-	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	const JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL_D(area);
 
 	return area->get_collision_mask();
 }
 
 void JoltPhysicsServer3D::_area_set_collision_layer(const RID& p_area, uint32_t p_layer) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->set_collision_layer(p_layer);
 }
 
 uint32_t JoltPhysicsServer3D::_area_get_collision_layer(const RID& p_area) const {
-	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	const JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL_D(area);
 
 	return area->get_collision_layer();
 }
 
 void JoltPhysicsServer3D::_area_set_monitorable(const RID& p_area, bool p_monitorable) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->set_monitorable(p_monitorable);
@@ -561,7 +648,7 @@ void JoltPhysicsServer3D::_area_set_monitor_callback(
 	const RID& p_area,
 	const Callable& p_callback
 ) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->set_body_monitor_callback(p_callback);
@@ -571,34 +658,34 @@ void JoltPhysicsServer3D::_area_set_area_monitor_callback(
 	const RID& p_area,
 	const Callable& p_callback
 ) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->set_area_monitor_callback(p_callback);
 }
 
 void JoltPhysicsServer3D::_area_set_ray_pickable(const RID& p_area, bool p_enable) {
-	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	JoltAreaImpl3D* area = get_area(p_area);
 	ERR_FAIL_NULL(area);
 
 	area->set_pickable(p_enable);
 }
 
 RID JoltPhysicsServer3D::_body_create() {
-	JoltBodyImpl3D* body = memnew(JoltBodyImpl3D);
+	JoltBodyImpl3D* body = _acquire_body();
 	RID rid = body_owner.make_rid(body);
 	body->set_rid(rid);
 	return rid;
 }
 
 void JoltPhysicsServer3D::_body_set_space(const RID& p_body, const RID& p_space) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	JoltSpace3D* space = nullptr;
 
 	if (p_space.is_valid()) {
-		space = space_owner.get_or_null(p_space);
+		space = get_space(p_space);
 		ERR_FAIL_NULL(space);
 	}
 
@@ -606,7 +693,7 @@ void JoltPhysicsServer3D::_body_set_space(const RID& p_body, const RID& p_space)
 }
 
 RID JoltPhysicsServer3D::_body_get_space(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	const JoltSpace3D* space = body->get_space();
@@ -619,14 +706,14 @@ RID JoltPhysicsServer3D::_body_get_space(const RID& p_body) const {
 }
 
 void JoltPhysicsServer3D::_body_set_mode(const RID& p_body, BodyMode p_mode) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_mode(p_mode);
 }
 
 PhysicsServer3D::BodyMode JoltPhysicsServer3D::_body_get_mode(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_mode();
@@ -638,10 +725,10 @@ void JoltPhysicsServer3D::_body_add_shape(
 	const Transform3D& p_transform,
 	bool p_disabled
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
-	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL(shape);
 
 	body->add_shape(shape, p_transform, p_disabled);
@@ -652,10 +739,10 @@ void JoltPhysicsServer3D::_body_set_shape(
 	int32_t p_shape_idx,
 	const RID& p_shape
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
-	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	JoltShapeImpl3D* shape = get_shape(p_shape);
 	ERR_FAIL_NULL(shape);
 
 	body->set_shape(p_shape_idx, shape);
@@ -666,21 +753,21 @@ void JoltPhysicsServer3D::_body_set_shape_transform(
 	int32_t p_shape_idx,
 	const Transform3D& p_transform
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_shape_transform(p_shape_idx, p_transform);
 }
 
 int32_t JoltPhysicsServer3D::_body_get_shape_count(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_shape_count();
 }
 
 RID JoltPhysicsServer3D::_body_get_shape(const RID& p_body, int32_t p_shape_idx) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	const JoltShapeImpl3D* shape = body->get_shape(p_shape_idx);
@@ -691,21 +778,21 @@ RID JoltPhysicsServer3D::_body_get_shape(const RID& p_body, int32_t p_shape_idx)
 
 Transform3D JoltPhysicsServer3D::_body_get_shape_transform(const RID& p_body, int32_t p_shape_idx)
 	const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_shape_transform_scaled(p_shape_idx);
 }
 
 void JoltPhysicsServer3D::_body_remove_shape(const RID& p_body, int32_t p_shape_idx) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->remove_shape(p_shape_idx);
 }
 
 void JoltPhysicsServer3D::_body_clear_shapes(const RID& p_body) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->clear_shapes();
@@ -716,21 +803,21 @@ void JoltPhysicsServer3D::_body_set_shape_disabled(
 	int32_t p_shape_idx,
 	bool p_disabled
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_shape_disabled(p_shape_idx, p_disabled);
 }
 
 void JoltPhysicsServer3D::_body_attach_object_instance_id(const RID& p_body, uint64_t p_id) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_instance_id(ObjectID(p_id));
 }
 
 uint64_t JoltPhysicsServer3D::_body_get_object_instance_id(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_instance_id();
@@ -740,56 +827,56 @@ void JoltPhysicsServer3D::_body_set_enable_continuous_collision_detection(
 	const RID& p_body,
 	bool p_enable
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_ccd_enabled(p_enable);
 }
 
 bool JoltPhysicsServer3D::_body_is_continuous_collision_detection_enabled(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->is_ccd_enabled();
 }
 
 void JoltPhysicsServer3D::_body_set_collision_layer(const RID& p_body, uint32_t p_layer) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_collision_layer(p_layer);
 }
 
 uint32_t JoltPhysicsServer3D::_body_get_collision_layer(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_collision_layer();
 }
 
 void JoltPhysicsServer3D::_body_set_collision_mask(const RID& p_body, uint32_t p_mask) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_collision_mask(p_mask);
 }
 
 uint32_t JoltPhysicsServer3D::_body_get_collision_mask(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_collision_mask();
 }
 
 void JoltPhysicsServer3D::_body_set_collision_priority(const RID& p_body, double p_priority) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_collision_priority((float)p_priority);
 }
 
 double JoltPhysicsServer3D::_body_get_collision_priority(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return (double)body->get_collision_priority();
@@ -814,21 +901,21 @@ void JoltPhysicsServer3D::_body_set_param(
 	BodyParameter p_param,
 	const Variant& p_value
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_param(p_param, p_value);
 }
 
 Variant JoltPhysicsServer3D::_body_get_param(const RID& p_body, BodyParameter p_param) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_param(p_param);
 }
 
 void JoltPhysicsServer3D::_body_reset_mass_properties(const RID& p_body) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->reset_mass_properties();
@@ -839,21 +926,21 @@ void JoltPhysicsServer3D::_body_set_state(
 	BodyState p_state,
 	const Variant& p_value
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_state(p_state, p_value);
 }
 
 Variant JoltPhysicsServer3D::_body_get_state(const RID& p_body, BodyState p_state) const {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_state(p_state);
 }
 
 void JoltPhysicsServer3D::_body_apply_central_impulse(const RID& p_body, const Vector3& p_impulse) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	return body->apply_central_impulse(p_impulse);
@@ -864,21 +951,21 @@ void JoltPhysicsServer3D::_body_apply_impulse(
 	const Vector3& p_impulse,
 	const Vector3& p_position
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	return body->apply_impulse(p_impulse, p_position);
 }
 
 void JoltPhysicsServer3D::_body_apply_torque_impulse(const RID& p_body, const Vector3& p_impulse) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	return body->apply_torque_impulse(p_impulse);
 }
 
 void JoltPhysicsServer3D::_body_apply_central_force(const RID& p_body, const Vector3& p_force) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	return body->apply_central_force(p_force);
@@ -889,14 +976,14 @@ void JoltPhysicsServer3D::_body_apply_force(
 	const Vector3& p_force,
 	const Vector3& p_position
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	return body->apply_force(p_force, p_position);
 }
 
 void JoltPhysicsServer3D::_body_apply_torque(const RID& p_body, const Vector3& p_torque) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	return body->apply_torque(p_torque);
@@ -906,7 +993,7 @@ void JoltPhysicsServer3D::_body_add_constant_central_force(
 	const RID& p_body,
 	const Vector3& p_force
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->add_constant_central_force(p_force);
@@ -917,42 +1004,42 @@ void JoltPhysicsServer3D::_body_add_constant_force(
 	const Vector3& p_force,
 	const Vector3& p_position
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->add_constant_force(p_force, p_position);
 }
 
 void JoltPhysicsServer3D::_body_add_constant_torque(const RID& p_body, const Vector3& p_torque) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->add_constant_torque(p_torque);
 }
 
 void JoltPhysicsServer3D::_body_set_constant_force(const RID& p_body, const Vector3& p_force) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_constant_force(p_force);
 }
 
 Vector3 JoltPhysicsServer3D::_body_get_constant_force(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_constant_force();
 }
 
 void JoltPhysicsServer3D::_body_set_constant_torque(const RID& p_body, const Vector3& p_torque) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_constant_torque(p_torque);
 }
 
 Vector3 JoltPhysicsServer3D::_body_get_constant_torque(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_constant_torque();
@@ -962,21 +1049,21 @@ void JoltPhysicsServer3D::_body_set_axis_velocity(
 	const RID& p_body,
 	const Vector3& p_axis_velocity
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_axis_velocity(p_axis_velocity);
 }
 
 void JoltPhysicsServer3D::_body_set_axis_lock(const RID& p_body, BodyAxis p_axis, bool p_lock) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_axis_lock(p_axis, p_lock);
 }
 
 bool JoltPhysicsServer3D::_body_is_axis_locked(const RID& p_body, BodyAxis p_axis) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->is_axis_locked(p_axis);
@@ -986,7 +1073,7 @@ void JoltPhysicsServer3D::_body_add_collision_exception(
 	const RID& p_body,
 	const RID& p_excepted_body
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->add_collision_exception(p_excepted_body);
@@ -996,28 +1083,28 @@ void JoltPhysicsServer3D::_body_remove_collision_exception(
 	const RID& p_body,
 	const RID& p_excepted_body
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->remove_collision_exception(p_excepted_body);
 }
 
 TypedArray<RID> JoltPhysicsServer3D::_body_get_collision_exceptions(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_collision_exceptions();
 }
 
 void JoltPhysicsServer3D::_body_set_max_contacts_reported(const RID& p_body, int32_t p_amount) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	return body->set_max_contacts_reported(p_amount);
 }
 
 int32_t JoltPhysicsServer3D::_body_get_max_contacts_reported(const RID& p_body) const {
-	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	const JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->get_max_contacts_reported();
@@ -1040,14 +1127,14 @@ double JoltPhysicsServer3D::_body_get_contacts_reported_depth_threshold(
 }
 
 void JoltPhysicsServer3D::_body_set_omit_force_integration(const RID& p_body, bool p_enable) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_custom_integrator(p_enable);
 }
 
 bool JoltPhysicsServer3D::_body_is_omitting_force_integration(const RID& p_body) const {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	return body->has_custom_integrator();
@@ -1057,7 +1144,7 @@ void JoltPhysicsServer3D::_body_set_state_sync_callback(
 	const RID& p_body,
 	const Callable& p_callable
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_state_sync_callback(p_callable);
@@ -1068,14 +1155,14 @@ void JoltPhysicsServer3D::_body_set_force_integration_callback(
 	const Callable& p_callable,
 	const Variant& p_userdata
 ) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_custom_integration_callback(p_callable, p_userdata);
 }
 
 void JoltPhysicsServer3D::_body_set_ray_pickable(const RID& p_body, bool p_enable) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL(body);
 
 	body->set_pickable(p_enable);
@@ -1091,7 +1178,7 @@ bool JoltPhysicsServer3D::_body_test_motion(
 	bool p_recovery_as_collision,
 	PhysicsServer3DExtensionMotionResult* p_result
 ) const {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	JoltSpace3D* space = body->get_space();
@@ -1110,7 +1197,7 @@ bool JoltPhysicsServer3D::_body_test_motion(
 }
 
 PhysicsDirectBodyState3D* JoltPhysicsServer3D::_body_get_direct_state(const RID& p_body) {
-	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	JoltBodyImpl3D* body = get_body(p_body);
 
 	// Unlike most other server methods this one is meant to quietly return null if the body has
 	// since been freed, which is used in places like `move_and_slide` to determine whether a
@@ -1360,7 +1447,7 @@ RID JoltPhysicsServer3D::_joint_create() {
 }
 
 void JoltPhysicsServer3D::_joint_clear(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	if (joint->get_type() != JOINT_TYPE_MAX) {
@@ -1379,13 +1466,13 @@ void JoltPhysicsServer3D::_joint_make_pin(
 	const RID& p_body_b,
 	const Vector3& p_local_b
 ) {
-	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* old_joint = get_joint(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
-	JoltBodyImpl3D* body_a = body_owner.get_or_null(p_body_a);
+	JoltBodyImpl3D* body_a = get_body(p_body_a);
 	ERR_FAIL_NULL(body_a);
 
-	JoltBodyImpl3D* body_b = body_owner.get_or_null(p_body_b);
+	JoltBodyImpl3D* body_b = get_body(p_body_b);
 	ERR_FAIL_COND(body_a == body_b);
 
 	JoltJointImpl3D* new_joint = memnew(
@@ -1401,7 +1488,7 @@ void JoltPhysicsServer3D::_pin_joint_set_param(
 	PinJointParam p_param,
 	double p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_PIN);
@@ -1411,7 +1498,7 @@ void JoltPhysicsServer3D::_pin_joint_set_param(
 }
 
 double JoltPhysicsServer3D::_pin_joint_get_param(const RID& p_joint, PinJointParam p_param) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_PIN);
@@ -1421,7 +1508,7 @@ double JoltPhysicsServer3D::_pin_joint_get_param(const RID& p_joint, PinJointPar
 }
 
 void JoltPhysicsServer3D::_pin_joint_set_local_a(const RID& p_joint, const Vector3& p_local_a) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_PIN);
@@ -1431,7 +1518,7 @@ void JoltPhysicsServer3D::_pin_joint_set_local_a(const RID& p_joint, const Vecto
 }
 
 Vector3 JoltPhysicsServer3D::_pin_joint_get_local_a(const RID& p_joint) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_PIN);
@@ -1441,7 +1528,7 @@ Vector3 JoltPhysicsServer3D::_pin_joint_get_local_a(const RID& p_joint) const {
 }
 
 void JoltPhysicsServer3D::_pin_joint_set_local_b(const RID& p_joint, const Vector3& p_local_b) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_PIN);
@@ -1451,7 +1538,7 @@ void JoltPhysicsServer3D::_pin_joint_set_local_b(const RID& p_joint, const Vecto
 }
 
 Vector3 JoltPhysicsServer3D::_pin_joint_get_local_b(const RID& p_joint) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_PIN);
@@ -1467,13 +1554,13 @@ void JoltPhysicsServer3D::_joint_make_hinge(
 	const RID& p_body_b,
 	const Transform3D& p_hinge_b
 ) {
-	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* old_joint = get_joint(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
-	JoltBodyImpl3D* body_a = body_owner.get_or_null(p_body_a);
+	JoltBodyImpl3D* body_a = get_body(p_body_a);
 	ERR_FAIL_NULL(body_a);
 
-	JoltBodyImpl3D* body_b = body_owner.get_or_null(p_body_b);
+	JoltBodyImpl3D* body_b = get_body(p_body_b);
 	ERR_FAIL_COND(body_a == body_b);
 
 	JoltJointImpl3D* new_joint = memnew(
@@ -1503,7 +1590,7 @@ void JoltPhysicsServer3D::_hinge_joint_set_param(
 	HingeJointParam p_param,
 	double p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_HINGE);
@@ -1514,7 +1601,7 @@ void JoltPhysicsServer3D::_hinge_joint_set_param(
 
 double JoltPhysicsServer3D::_hinge_joint_get_param(const RID& p_joint, HingeJointParam p_param)
 	const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
@@ -1528,7 +1615,7 @@ void JoltPhysicsServer3D::_hinge_joint_set_flag(
 	HingeJointFlag p_flag,
 	bool p_enabled
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_HINGE);
@@ -1538,7 +1625,7 @@ void JoltPhysicsServer3D::_hinge_joint_set_flag(
 }
 
 bool JoltPhysicsServer3D::_hinge_joint_get_flag(const RID& p_joint, HingeJointFlag p_flag) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
@@ -1554,13 +1641,13 @@ void JoltPhysicsServer3D::_joint_make_slider(
 	const RID& p_body_b,
 	const Transform3D& p_local_ref_b
 ) {
-	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* old_joint = get_joint(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
-	JoltBodyImpl3D* body_a = body_owner.get_or_null(p_body_a);
+	JoltBodyImpl3D* body_a = get_body(p_body_a);
 	ERR_FAIL_NULL(body_a);
 
-	JoltBodyImpl3D* body_b = body_owner.get_or_null(p_body_b);
+	JoltBodyImpl3D* body_b = get_body(p_body_b);
 	ERR_FAIL_COND(body_a == body_b);
 
 	JoltJointImpl3D* new_joint = memnew(
@@ -1576,7 +1663,7 @@ void JoltPhysicsServer3D::_slider_joint_set_param(
 	SliderJointParam p_param,
 	double p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_SLIDER);
@@ -1587,7 +1674,7 @@ void JoltPhysicsServer3D::_slider_joint_set_param(
 
 double JoltPhysicsServer3D::_slider_joint_get_param(const RID& p_joint, SliderJointParam p_param)
 	const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_SLIDER);
@@ -1603,13 +1690,13 @@ void JoltPhysicsServer3D::_joint_make_cone_twist(
 	const RID& p_body_b,
 	const Transform3D& p_local_ref_b
 ) {
-	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* old_joint = get_joint(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
-	JoltBodyImpl3D* body_a = body_owner.get_or_null(p_body_a);
+	JoltBodyImpl3D* body_a = get_body(p_body_a);
 	ERR_FAIL_NULL(body_a);
 
-	JoltBodyImpl3D* body_b = body_owner.get_or_null(p_body_b);
+	JoltBodyImpl3D* body_b = get_body(p_body_b);
 	ERR_FAIL_COND(body_a == body_b);
 
 	JoltJointImpl3D* new_joint = memnew(
@@ -1625,7 +1712,7 @@ void JoltPhysicsServer3D::_cone_twist_joint_set_param(
 	ConeTwistJointParam p_param,
 	double p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_CONE_TWIST);
@@ -1638,7 +1725,7 @@ double JoltPhysicsServer3D::_cone_twist_joint_get_param(
 	const RID& p_joint,
 	ConeTwistJointParam p_param
 ) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_CONE_TWIST);
@@ -1654,13 +1741,13 @@ void JoltPhysicsServer3D::_joint_make_generic_6dof(
 	const RID& p_body_b,
 	const Transform3D& p_local_ref_b
 ) {
-	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* old_joint = get_joint(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
-	JoltBodyImpl3D* body_a = body_owner.get_or_null(p_body_a);
+	JoltBodyImpl3D* body_a = get_body(p_body_a);
 	ERR_FAIL_NULL(body_a);
 
-	JoltBodyImpl3D* body_b = body_owner.get_or_null(p_body_b);
+	JoltBodyImpl3D* body_b = get_body(p_body_b);
 	ERR_FAIL_COND(body_a == body_b);
 
 	JoltJointImpl3D* new_joint = memnew(
@@ -1677,7 +1764,7 @@ void JoltPhysicsServer3D::_generic_6dof_joint_set_param(
 	PhysicsServer3D::G6DOFJointAxisParam p_param,
 	double p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_6DOF);
@@ -1691,7 +1778,7 @@ double JoltPhysicsServer3D::_generic_6dof_joint_get_param(
 	Vector3::Axis p_axis,
 	PhysicsServer3D::G6DOFJointAxisParam p_param
 ) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
@@ -1706,7 +1793,7 @@ void JoltPhysicsServer3D::_generic_6dof_joint_set_flag(
 	PhysicsServer3D::G6DOFJointAxisFlag p_flag,
 	bool p_enable
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_6DOF);
@@ -1720,7 +1807,7 @@ bool JoltPhysicsServer3D::_generic_6dof_joint_get_flag(
 	Vector3::Axis p_axis,
 	PhysicsServer3D::G6DOFJointAxisFlag p_flag
 ) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
@@ -1730,21 +1817,21 @@ bool JoltPhysicsServer3D::_generic_6dof_joint_get_flag(
 }
 
 PhysicsServer3D::JointType JoltPhysicsServer3D::_joint_get_type(const RID& p_joint) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	return joint->get_type();
 }
 
 void JoltPhysicsServer3D::_joint_set_solver_priority(const RID& p_joint, int32_t p_priority) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	joint->set_solver_priority(p_priority);
 }
 
 int32_t JoltPhysicsServer3D::_joint_get_solver_priority(const RID& p_joint) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	return joint->get_solver_priority();
@@ -1754,29 +1841,29 @@ void JoltPhysicsServer3D::_joint_disable_collisions_between_bodies(
 	const RID& p_joint,
 	bool p_disable
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	joint->set_collision_disabled(p_disable);
 }
 
 bool JoltPhysicsServer3D::_joint_is_disabled_collisions_between_bodies(const RID& p_joint) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	return joint->is_collision_disabled();
 }
 
 void JoltPhysicsServer3D::_free_rid(const RID& p_rid) {
-	if (JoltShapeImpl3D* shape = shape_owner.get_or_null(p_rid)) {
+	if (JoltShapeImpl3D* shape = get_shape(p_rid)) {
 		free_shape(shape);
-	} else if (JoltBodyImpl3D* body = body_owner.get_or_null(p_rid)) {
+	} else if (JoltBodyImpl3D* body = get_body(p_rid)) {
 		free_body(body);
-	} else if (JoltJointImpl3D* joint = joint_owner.get_or_null(p_rid)) {
+	} else if (JoltJointImpl3D* joint = get_joint(p_rid)) {
 		free_joint(joint);
-	} else if (JoltAreaImpl3D* area = area_owner.get_or_null(p_rid)) {
+	} else if (JoltAreaImpl3D* area = get_area(p_rid)) {
 		free_area(area);
-	} else if (JoltSpace3D* space = space_owner.get_or_null(p_rid)) {
+	} else if (JoltSpace3D* space = get_space(p_rid)) {
 		free_space(space);
 	} else {
 		ERR_FAIL_MSG("Failed to free RID: The specified RID has no owner.");
@@ -1796,13 +1883,24 @@ void JoltPhysicsServer3D::_step(double p_step) {
 		return;
 	}
 
-	job_system->pre_step();
+	wait_for_step();
 
-	for (JoltSpace3D* active_space : active_spaces) {
-		active_space->step((float)p_step);
+	if (!JoltProjectSettings::should_run_on_separate_thread()) {
+		_step_spaces((float)p_step);
+		return;
 	}
 
-	job_system->post_step();
+	static const String task_name("JoltPhysicsStep");
+
+	pending_step = (float)p_step;
+
+	WorkerThreadPool* thread_pool = WorkerThreadPool::get_singleton();
+	const int64_t task_id = thread_pool->add_native_task(&_execute_step, this, true, task_name);
+	step_task_id.store(task_id, std::memory_order_release);
+}
+
+void JoltPhysicsServer3D::_sync() {
+	wait_for_step();
 }
 
 void JoltPhysicsServer3D::_flush_queries() {
@@ -1810,6 +1908,8 @@ void JoltPhysicsServer3D::_flush_queries() {
 		return;
 	}
 
+	wait_for_step();
+
 	flushing_queries = true;
 
 	for (JoltSpace3D* space : active_spaces) {
@@ -1824,6 +1924,8 @@ void JoltPhysicsServer3D::_flush_queries() {
 }
 
 void JoltPhysicsServer3D::_finish() {
+	wait_for_step();
+
 	delete_safely(job_system);
 }
 
@@ -1857,7 +1959,15 @@ void JoltPhysicsServer3D::free_body(JoltBodyImpl3D* p_body) {
 
 	p_body->set_space(nullptr);
 	body_owner.free(p_body->get_rid());
-	memdelete_safely(p_body);
+
+	// Games that spawn and free lots of bodies (like projectiles or debris) can opt into keeping
+	// freed bodies around, so that creating new ones doesn't need to allocate anything.
+	if (body_pool.size() < JoltProjectSettings::get_max_pooled_bodies()) {
+		p_body->recycle();
+		body_pool.push_back(p_body);
+	} else {
+		memdelete_safely(p_body);
+	}
 }
 
 void JoltPhysicsServer3D::free_shape(JoltShapeImpl3D* p_shape) {
@@ -1875,6 +1985,167 @@ void JoltPhysicsServer3D::free_joint(JoltJointImpl3D* p_joint) {
 	memdelete_safely(p_joint);
 }
 
+void JoltPhysicsServer3D::wait_for_step() const {
+	// Anything running as part of the step, like a batch integrator, would otherwise end up
+	// waiting on itself
+	if (stepping_thread) {
+		return;
+	}
+
+	if (step_task_id.load(std::memory_order_acquire) == -1) {
+		return;
+	}
+
+	// This can be reached from any thread that makes queries or reads state, so only one of them
+	// gets to wait on the task, while the others wait for that thread to finish waiting.
+	const std::lock_guard lock(step_mutex);
+
+	const int64_t task_id = step_task_id.load(std::memory_order_relaxed);
+
+	if (task_id == -1) {
+		return;
+	}
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+
+	step_task_id.store(-1, std::memory_order_release);
+}
+
+void JoltPhysicsServer3D::_execute_step(void* p_user_data) {
+	auto* physics_server = static_cast<JoltPhysicsServer3D*>(p_user_data);
+
+	stepping_thread = true;
+	physics_server->_step_spaces(physics_server->pending_step);
+	stepping_thread = false;
+}
+
+void JoltPhysicsServer3D::_step_spaces(float p_step) {
+	job_system->pre_step();
+
+	if (active_spaces.size() > 1 && JoltProjectSettings::should_step_spaces_in_parallel()) {
+		_step_spaces_in_parallel(p_step);
+	} else {
+		for (JoltSpace3D* active_space : active_spaces) {
+			active_space->step(p_step);
+		}
+	}
+
+	job_system->post_step();
+}
+
+template<typename TCallback>
+void JoltPhysicsServer3D::_write_bodies(
+	const PackedInt64Array& p_bodies,
+	bool p_activate,
+	TCallback&& p_callback
+) {
+	wait_for_step();
+
+	const auto rid_count = (int32_t)p_bodies.size();
+	const int64_t* rids = p_bodies.ptr();
+
+	LocalVector<JoltBodyImpl3D*> bodies;
+	LocalVector<int32_t> indices;
+
+	bodies.reserve((uint32_t)rid_count);
+	indices.reserve((uint32_t)rid_count);
+
+	for (int32_t i = 0; i < rid_count; ++i) {
+		JoltBodyImpl3D* body = body_owner.get_or_null(rids[i]);
+		ERR_CONTINUE(body == nullptr);
+
+		bodies.push_back(body);
+		indices.push_back(i);
+	}
+
+	const int32_t body_count = bodies.size();
+
+	JPH::BodyIDVector body_ids;
+
+	const auto write_body = [&](JoltBodyImpl3D& p_body, int32_t p_index, bool p_lock) {
+		const bool was_sleeping = !p_activate && p_body.is_sleeping(p_lock);
+
+		p_callback(p_body, p_index, p_lock);
+
+		if (was_sleeping) {
+			p_body.put_to_sleep(p_lock);
+		}
+	};
+
+	// Bodies that share a space are locked all at once, which means the bodies should ideally be
+	// ordered by space, but any order will do.
+	for (int32_t start = 0, end = 0; start < body_count; start = end) {
+		JoltSpace3D* space = bodies[start]->get_space();
+
+		body_ids.clear();
+
+		for (end = start; end < body_count && bodies[end]->get_space() == space; ++end) {
+			body_ids.push_back(bodies[end]->get_jolt_id());
+		}
+
+		if (space == nullptr) {
+			for (int32_t i = start; i < end; ++i) {
+				write_body(*bodies[i], indices[i], true);
+			}
+
+			continue;
+		}
+
+		const JoltWritableBodies3D jolt_bodies = space->write_bodies(
+			body_ids.data(),
+			(int32_t)body_ids.size()
+		);
+
+		for (int32_t i = start; i < end; ++i) {
+			write_body(*bodies[i], indices[i], false);
+		}
+	}
+}
+
+void JoltPhysicsServer3D::_step_spaces_in_parallel(float p_step) {
+	// HACK(mihe): Much like with the jobs themselves we use the same cached description for all of
+	// these tasks, to avoid allocating a new string every step.
+	static const String task_name("JoltPhysicsSpaces");
+
+	SpaceStepContext context;
+	context.spaces = active_spaces.ptr();
+	context.space_count = active_spaces.size();
+	context.step = p_step;
+
+	// Each space owns its own temporary allocator and contact listener, but they all share the job
+	// system, which only has enough barriers and jobs for a limited number of concurrent
+	// `PhysicsSystem::Update` calls, so we cap the number of tasks (including the calling thread)
+	// to that and let them pull spaces from a shared counter instead.
+	const int32_t task_count = min(context.space_count, JoltJobSystem::MAX_CONCURRENT_STEPS);
+
+	WorkerThreadPool* thread_pool = WorkerThreadPool::get_singleton();
+
+	const int64_t group_id = thread_pool->add_native_group_task(
+		&step_spaces,
+		&context,
+		task_count - 1,
+		task_count - 1,
+		true,
+		task_name
+	);
+
+	step_spaces(&context, 0);
+
+	thread_pool->wait_for_group_task_completion(group_id);
+}
+
+JoltBodyImpl3D* JoltPhysicsServer3D::_acquire_body() {
+	if (body_pool.is_empty()) {
+		return memnew(JoltBodyImpl3D);
+	}
+
+	const int32_t last_index = body_pool.size() - 1;
+	JoltBodyImpl3D* body = body_pool[last_index];
+	body_pool.remove_at_unordered(last_index);
+
+	return body;
+}
+
 #ifdef GDJ_CONFIG_EDITOR
 
 void JoltPhysicsServer3D::dump_debug_snapshots(const String& p_dir) {
@@ -1884,7 +2155,7 @@ void JoltPhysicsServer3D::dump_debug_snapshots(const String& p_dir) {
 }
 
 void JoltPhysicsServer3D::space_dump_debug_snapshot(const RID& p_space, const String& p_dir) {
-	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	JoltSpace3D* space = get_space(p_space);
 	ERR_FAIL_NULL(space);
 
 	space->dump_debug_snapshot(p_dir);
@@ -1892,22 +2163,344 @@ void JoltPhysicsServer3D::space_dump_debug_snapshot(const RID& p_space, const St
 
 #endif // GDJ_CONFIG_EDITOR
 
+bool JoltPhysicsServer3D::is_tracing_enabled() const {
+	return JoltTracer::is_enabled();
+}
+
+void JoltPhysicsServer3D::set_tracing_enabled(bool p_enabled) {
+	JoltTracer::set_enabled(p_enabled);
+}
+
+void JoltPhysicsServer3D::clear_trace() {
+	wait_for_step();
+
+	JoltTracer::clear();
+}
+
+Error JoltPhysicsServer3D::dump_trace(const String& p_path) {
+	// The step might otherwise still be writing to the trace while we're reading from it
+	wait_for_step();
+
+	return JoltTracer::dump(p_path);
+}
+
+int32_t JoltPhysicsServer3D::space_get_collision_steps(const RID& p_space) const {
+	const JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_collision_steps();
+}
+
+void JoltPhysicsServer3D::space_set_collision_steps(const RID& p_space, int32_t p_steps) {
+	JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND(p_steps < 1);
+
+	space->set_collision_steps(p_steps);
+}
+
+Dictionary JoltPhysicsServer3D::space_get_temp_memory_stats(const RID& p_space) const {
+	const JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	const JoltTempAllocator& temp_allocator = space->get_temp_allocator();
+
+	Dictionary stats;
+	stats["capacity"] = (int64_t)temp_allocator.get_capacity();
+	stats["peak_usage"] = (int64_t)temp_allocator.get_peak_usage();
+	stats["overflow_count"] = temp_allocator.get_overflow_count();
+
+	return stats;
+}
+
+Dictionary JoltPhysicsServer3D::space_get_active_body_states(const RID& p_space) {
+	JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	PackedInt64Array rids;
+	PackedFloat32Array states;
+
+	const int32_t body_count = space->get_active_body_states(rids, states);
+
+	rids.resize(body_count);
+	states.resize((int64_t)body_count * JoltSpace3D::PACKED_BODY_STATE_SIZE);
+
+	Dictionary result;
+	result["rids"] = rids;
+	result["states"] = states;
+
+	return result;
+}
+
+bool JoltPhysicsServer3D::space_is_interpolation_enabled(const RID& p_space) const {
+	const JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->is_interpolation_enabled();
+}
+
+void JoltPhysicsServer3D::space_set_interpolation_enabled(const RID& p_space, bool p_enabled) {
+	JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->set_interpolation_enabled(p_enabled);
+}
+
+Dictionary JoltPhysicsServer3D::space_get_interpolated_transforms(
+	const RID& p_space,
+	float p_alpha
+) const {
+	const JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	PackedInt64Array rids;
+	PackedFloat32Array transforms;
+
+	const int32_t body_count = space->interpolate_into(p_alpha, rids, transforms);
+
+	rids.resize(body_count);
+	transforms.resize((int64_t)body_count * PACKED_TRANSFORM_SIZE);
+
+	Dictionary result;
+	result["rids"] = rids;
+	result["transforms"] = transforms;
+
+	return result;
+}
+
+bool JoltPhysicsServer3D::space_is_contact_stream_enabled(const RID& p_space) const {
+	const JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->is_contact_stream_enabled();
+}
+
+void JoltPhysicsServer3D::space_set_contact_stream_enabled(const RID& p_space, bool p_enabled) {
+	JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->set_contact_stream_enabled(p_enabled);
+}
+
+Dictionary JoltPhysicsServer3D::space_get_contact_stream(const RID& p_space) const {
+	const JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	const JoltContactListener3D::ContactStream& stream = space->get_contact_stream();
+
+	// These are all copy-on-write, so handing them out is cheap, but holding on to them past the
+	// next step will cause that step to copy them
+	Dictionary result;
+	result["bodies"] = stream.bodies;
+	result["body_offsets"] = stream.body_offsets;
+	result["body_counts"] = stream.body_counts;
+	result["colliders"] = stream.colliders;
+	result["shapes"] = stream.shapes;
+	result["collider_shapes"] = stream.collider_shapes;
+	result["points"] = stream.points;
+	result["normals"] = stream.normals;
+	result["impulses"] = stream.impulses;
+
+	return result;
+}
+
+PackedInt64Array JoltPhysicsServer3D::bodies_create_batch(
+	const RID& p_space,
+	const RID& p_shape,
+	BodyMode p_mode,
+	const PackedFloat32Array& p_transforms,
+	uint32_t p_collision_layer,
+	uint32_t p_collision_mask
+) {
+	JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	JoltShapeImpl3D* shape = get_shape(p_shape);
+	ERR_FAIL_NULL_D(shape);
+
+	ERR_FAIL_COND_D_MSG(
+		p_transforms.size() % PACKED_TRANSFORM_SIZE != 0,
+		vformat(
+			"Failed to create bodies in batch. "
+			"Expected the number of floats in the transform array to be a multiple of %d, "
+			"but got %d.",
+			PACKED_TRANSFORM_SIZE,
+			p_transforms.size()
+		)
+	);
+
+	const auto body_count = (int32_t)(p_transforms.size() / PACKED_TRANSFORM_SIZE);
+
+	PackedInt64Array rids;
+	rids.resize(body_count);
+
+	const float* transforms = p_transforms.ptr();
+	int64_t* rids_ptr = rids.ptrw();
+
+	for (int32_t i = 0; i < body_count; ++i) {
+		const Transform3D transform = unpack_transform(
+			transforms + (ptrdiff_t)i * PACKED_TRANSFORM_SIZE
+		);
+
+		JoltBodyImpl3D* body = _acquire_body();
+		const RID rid = body_owner.make_rid(body);
+		body->set_rid(rid);
+
+		// Everything is set up before the body enters the space, so that it ends up being created
+		// in one go and then added to the broad phase together with the rest of the batch.
+		body->set_mode(p_mode);
+		body->set_collision_layer(p_collision_layer);
+		body->set_collision_mask(p_collision_mask);
+		body->add_shape(shape, Transform3D(), false);
+		body->set_transform(transform);
+		body->set_space(space);
+
+		rids_ptr[i] = rid.get_id();
+	}
+
+	return rids;
+}
+
+void JoltPhysicsServer3D::area_set_body_monitor_batch_callback(
+	const RID& p_area,
+	const Callable& p_callback
+) {
+	JoltAreaImpl3D* area = get_area(p_area);
+	ERR_FAIL_NULL(area);
+
+	area->set_body_monitor_batch_callback(p_callback);
+}
+
+void JoltPhysicsServer3D::area_set_area_monitor_batch_callback(
+	const RID& p_area,
+	const Callable& p_callback
+) {
+	JoltAreaImpl3D* area = get_area(p_area);
+	ERR_FAIL_NULL(area);
+
+	area->set_area_monitor_batch_callback(p_callback);
+}
+
+void JoltPhysicsServer3D::space_set_batch_integrator(
+	const RID& p_space,
+	JoltBatchIntegrator p_integrator,
+	void* p_userdata,
+	bool p_parallel
+) {
+	JoltSpace3D* space = get_space(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->set_batch_integrator(p_integrator, p_userdata, p_parallel);
+}
+
+bool JoltPhysicsServer3D::body_is_batch_integrated(const RID& p_body) const {
+	const JoltBodyImpl3D* body = get_body(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	return body->is_batch_integrated();
+}
+
+void JoltPhysicsServer3D::body_set_batch_integrated(const RID& p_body, bool p_enabled) {
+	JoltBodyImpl3D* body = get_body(p_body);
+	ERR_FAIL_NULL(body);
+
+	body->set_batch_integrated(p_enabled);
+}
+
+bool JoltPhysicsServer3D::body_is_parked(const RID& p_body) const {
+	const JoltBodyImpl3D* body = get_body(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	return body->is_parked();
+}
+
+void JoltPhysicsServer3D::body_set_parked(const RID& p_body, bool p_enabled) {
+	JoltBodyImpl3D* body = get_body(p_body);
+	ERR_FAIL_NULL(body);
+
+	body->set_parked(p_enabled);
+}
+
+uint32_t JoltPhysicsServer3D::body_get_contact_fields(const RID& p_body) const {
+	const JoltBodyImpl3D* body = get_body(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	return body->get_contact_fields();
+}
+
+void JoltPhysicsServer3D::body_set_contact_fields(const RID& p_body, uint32_t p_fields) {
+	JoltBodyImpl3D* body = get_body(p_body);
+	ERR_FAIL_NULL(body);
+
+	body->set_contact_fields(p_fields);
+}
+
+void JoltPhysicsServer3D::bodies_set_transforms(
+	const PackedInt64Array& p_bodies,
+	const PackedFloat32Array& p_transforms,
+	bool p_activate
+) {
+	ERR_FAIL_COND_MSG(
+		p_transforms.size() != p_bodies.size() * PACKED_TRANSFORM_SIZE,
+		vformat(
+			"Failed to set transforms of bodies. "
+			"Expected %d floats in the transform array, but got %d.",
+			p_bodies.size() * PACKED_TRANSFORM_SIZE,
+			p_transforms.size()
+		)
+	);
+
+	const float* transforms = p_transforms.ptr();
+
+	_write_bodies(p_bodies, p_activate, [&](JoltBodyImpl3D& p_body, int32_t p_index, bool p_lock) {
+		const float* transform = transforms + (ptrdiff_t)p_index * PACKED_TRANSFORM_SIZE;
+		p_body.set_transform(unpack_transform(transform), p_lock);
+	});
+}
+
+void JoltPhysicsServer3D::bodies_set_velocities(
+	const PackedInt64Array& p_bodies,
+	const PackedFloat32Array& p_velocities,
+	bool p_activate
+) {
+	// Each velocity consists of the linear velocity followed by the angular velocity
+	constexpr int32_t floats_per_velocity = 6;
+
+	ERR_FAIL_COND_MSG(
+		p_velocities.size() != p_bodies.size() * floats_per_velocity,
+		vformat(
+			"Failed to set velocities of bodies. "
+			"Expected %d floats in the velocity array, but got %d.",
+			p_bodies.size() * floats_per_velocity,
+			p_velocities.size()
+		)
+	);
+
+	const float* velocities = p_velocities.ptr();
+
+	_write_bodies(p_bodies, p_activate, [&](JoltBodyImpl3D& p_body, int32_t p_index, bool p_lock) {
+		const float* velocity = velocities + (ptrdiff_t)p_index * floats_per_velocity;
+		p_body.set_linear_velocity({velocity[0], velocity[1], velocity[2]}, p_lock);
+		p_body.set_angular_velocity({velocity[3], velocity[4], velocity[5]}, p_lock);
+	});
+}
+
 bool JoltPhysicsServer3D::joint_get_enabled(const RID& p_joint) const {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	return joint->is_enabled();
 }
 
 void JoltPhysicsServer3D::joint_set_enabled(const RID& p_joint, bool p_enabled) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	joint->set_enabled(p_enabled);
 }
 
 int32_t JoltPhysicsServer3D::joint_get_solver_velocity_iterations(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	return joint->get_solver_velocity_iterations();
@@ -1917,14 +2510,14 @@ void JoltPhysicsServer3D::joint_set_solver_velocity_iterations(
 	const RID& p_joint,
 	int32_t p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	return joint->set_solver_velocity_iterations(p_value);
 }
 
 int32_t JoltPhysicsServer3D::joint_get_solver_position_iterations(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	return joint->get_solver_position_iterations();
@@ -1934,14 +2527,14 @@ void JoltPhysicsServer3D::joint_set_solver_position_iterations(
 	const RID& p_joint,
 	int32_t p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	return joint->set_solver_position_iterations(p_value);
 }
 
 float JoltPhysicsServer3D::pin_joint_get_applied_force(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_PIN);
@@ -1954,7 +2547,7 @@ double JoltPhysicsServer3D::hinge_joint_get_jolt_param(
 	const RID& p_joint,
 	HingeJointParamJolt p_param
 ) const {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
@@ -1968,7 +2561,7 @@ void JoltPhysicsServer3D::hinge_joint_set_jolt_param(
 	HingeJointParamJolt p_param,
 	double p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_HINGE);
@@ -1979,7 +2572,7 @@ void JoltPhysicsServer3D::hinge_joint_set_jolt_param(
 
 bool JoltPhysicsServer3D::hinge_joint_get_jolt_flag(const RID& p_joint, HingeJointFlagJolt p_flag)
 	const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
@@ -1993,7 +2586,7 @@ void JoltPhysicsServer3D::hinge_joint_set_jolt_flag(
 	HingeJointFlagJolt p_flag,
 	bool p_enabled
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_HINGE);
@@ -2003,7 +2596,7 @@ void JoltPhysicsServer3D::hinge_joint_set_jolt_flag(
 }
 
 float JoltPhysicsServer3D::hinge_joint_get_applied_force(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
@@ -2013,7 +2606,7 @@ float JoltPhysicsServer3D::hinge_joint_get_applied_force(const RID& p_joint) {
 }
 
 float JoltPhysicsServer3D::hinge_joint_get_applied_torque(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
@@ -2026,7 +2619,7 @@ double JoltPhysicsServer3D::slider_joint_get_jolt_param(
 	const RID& p_joint,
 	SliderJointParamJolt p_param
 ) const {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_SLIDER);
@@ -2040,7 +2633,7 @@ void JoltPhysicsServer3D::slider_joint_set_jolt_param(
 	SliderJointParamJolt p_param,
 	double p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_SLIDER);
@@ -2051,7 +2644,7 @@ void JoltPhysicsServer3D::slider_joint_set_jolt_param(
 
 bool JoltPhysicsServer3D::slider_joint_get_jolt_flag(const RID& p_joint, SliderJointFlagJolt p_flag)
 	const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_SLIDER);
@@ -2065,7 +2658,7 @@ void JoltPhysicsServer3D::slider_joint_set_jolt_flag(
 	SliderJointFlagJolt p_flag,
 	bool p_enabled
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_SLIDER);
@@ -2075,7 +2668,7 @@ void JoltPhysicsServer3D::slider_joint_set_jolt_flag(
 }
 
 float JoltPhysicsServer3D::slider_joint_get_applied_force(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_SLIDER);
@@ -2085,7 +2678,7 @@ float JoltPhysicsServer3D::slider_joint_get_applied_force(const RID& p_joint) {
 }
 
 float JoltPhysicsServer3D::slider_joint_get_applied_torque(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_SLIDER);
@@ -2098,7 +2691,7 @@ double JoltPhysicsServer3D::cone_twist_joint_get_jolt_param(
 	const RID& p_joint,
 	ConeTwistJointParamJolt p_param
 ) const {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_CONE_TWIST);
@@ -2112,7 +2705,7 @@ void JoltPhysicsServer3D::cone_twist_joint_set_jolt_param(
 	ConeTwistJointParamJolt p_param,
 	double p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_CONE_TWIST);
@@ -2125,7 +2718,7 @@ bool JoltPhysicsServer3D::cone_twist_joint_get_jolt_flag(
 	const RID& p_joint,
 	ConeTwistJointFlagJolt p_flag
 ) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_CONE_TWIST);
@@ -2139,7 +2732,7 @@ void JoltPhysicsServer3D::cone_twist_joint_set_jolt_flag(
 	ConeTwistJointFlagJolt p_flag,
 	bool p_enabled
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_CONE_TWIST);
@@ -2149,7 +2742,7 @@ void JoltPhysicsServer3D::cone_twist_joint_set_jolt_flag(
 }
 
 float JoltPhysicsServer3D::cone_twist_joint_get_applied_force(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_CONE_TWIST);
@@ -2159,7 +2752,7 @@ float JoltPhysicsServer3D::cone_twist_joint_get_applied_force(const RID& p_joint
 }
 
 float JoltPhysicsServer3D::cone_twist_joint_get_applied_torque(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_CONE_TWIST);
@@ -2173,7 +2766,7 @@ double JoltPhysicsServer3D::generic_6dof_joint_get_jolt_param(
 	Vector3::Axis p_axis,
 	G6DOFJointAxisParamJolt p_param
 ) const {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
@@ -2188,7 +2781,7 @@ void JoltPhysicsServer3D::generic_6dof_joint_set_jolt_param(
 	G6DOFJointAxisParamJolt p_param,
 	double p_value
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_6DOF);
@@ -2202,7 +2795,7 @@ bool JoltPhysicsServer3D::generic_6dof_joint_get_jolt_flag(
 	Vector3::Axis p_axis,
 	G6DOFJointAxisFlagJolt p_flag
 ) const {
-	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	const JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
@@ -2217,7 +2810,7 @@ void JoltPhysicsServer3D::generic_6dof_joint_set_jolt_flag(
 	G6DOFJointAxisFlagJolt p_flag,
 	bool p_enabled
 ) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL(joint);
 
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_6DOF);
@@ -2227,7 +2820,7 @@ void JoltPhysicsServer3D::generic_6dof_joint_set_jolt_flag(
 }
 
 float JoltPhysicsServer3D::generic_6dof_joint_get_applied_force(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
@@ -2237,7 +2830,7 @@ float JoltPhysicsServer3D::generic_6dof_joint_get_applied_force(const RID& p_joi
 }
 
 float JoltPhysicsServer3D::generic_6dof_joint_get_applied_torque(const RID& p_joint) {
-	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
+	JoltJointImpl3D* joint = get_joint(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
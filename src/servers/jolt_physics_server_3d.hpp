@@ -1,5 +1,7 @@
 #pragma once
 
+#include "spaces/jolt_batch_integrator.hpp"
+
 class JoltAreaImpl3D;
 class JoltBodyImpl3D;
 class JoltJobSystem;
@@ -76,6 +78,11 @@ public:
 		G6DOF_JOINT_FLAG_ENABLE_ANGULAR_SPRING_FREQUENCY,
 	};
 
+	enum BodyContactFieldJolt {
+		BODY_CONTACT_FIELD_VELOCITIES = 1 << 0,
+		BODY_CONTACT_FIELD_IMPULSES = 1 << 1
+	};
+
 private:
 	static void _bind_methods();
 
@@ -605,7 +612,7 @@ public:
 
 	void _step(double p_step) override;
 
-	void _sync() override { }
+	void _sync() override;
 
 	void _flush_queries() override;
 
@@ -617,6 +624,14 @@ public:
 
 	int32_t _get_process_info(PhysicsServer3D::ProcessInfo p_process_info) override;
 
+	void wait_for_step() const;
+
+	// Whether the calling thread is running the step, or one of the jobs that make it up, in which
+	// case there's no point in waiting for the step, since it would never finish.
+	static bool is_stepping_thread() { return stepping_thread; }
+
+	static void set_stepping_thread(bool p_enabled) { stepping_thread = p_enabled; }
+
 	void free_space(JoltSpace3D* p_space);
 
 	void free_area(JoltAreaImpl3D* p_area);
@@ -627,15 +642,30 @@ public:
 
 	void free_joint(JoltJointImpl3D* p_joint);
 
-	JoltSpace3D* get_space(const RID& p_rid) const { return space_owner.get_or_null(p_rid); }
+	JoltSpace3D* get_space(const RID& p_rid) const {
+		wait_for_step();
+		return space_owner.get_or_null(p_rid);
+	}
 
-	JoltAreaImpl3D* get_area(const RID& p_rid) const { return area_owner.get_or_null(p_rid); }
+	JoltAreaImpl3D* get_area(const RID& p_rid) const {
+		wait_for_step();
+		return area_owner.get_or_null(p_rid);
+	}
 
-	JoltBodyImpl3D* get_body(const RID& p_rid) const { return body_owner.get_or_null(p_rid); }
+	JoltBodyImpl3D* get_body(const RID& p_rid) const {
+		wait_for_step();
+		return body_owner.get_or_null(p_rid);
+	}
 
-	JoltShapeImpl3D* get_shape(const RID& p_rid) const { return shape_owner.get_or_null(p_rid); }
+	JoltShapeImpl3D* get_shape(const RID& p_rid) const {
+		wait_for_step();
+		return shape_owner.get_or_null(p_rid);
+	}
 
-	JoltJointImpl3D* get_joint(const RID& p_rid) const { return joint_owner.get_or_null(p_rid); }
+	JoltJointImpl3D* get_joint(const RID& p_rid) const {
+		wait_for_step();
+		return joint_owner.get_or_null(p_rid);
+	}
 
 #ifdef GDJ_CONFIG_EDITOR
 	void dump_debug_snapshots(const String& p_dir);
@@ -643,6 +673,79 @@ public:
 	void space_dump_debug_snapshot(const RID& p_space, const String& p_dir);
 #endif // GDJ_CONFIG_EDITOR
 
+	bool is_tracing_enabled() const;
+
+	void set_tracing_enabled(bool p_enabled);
+
+	void clear_trace();
+
+	Error dump_trace(const String& p_path);
+
+	int32_t space_get_collision_steps(const RID& p_space) const;
+
+	void space_set_collision_steps(const RID& p_space, int32_t p_steps);
+
+	Dictionary space_get_temp_memory_stats(const RID& p_space) const;
+
+	Dictionary space_get_active_body_states(const RID& p_space);
+
+	bool space_is_interpolation_enabled(const RID& p_space) const;
+
+	void space_set_interpolation_enabled(const RID& p_space, bool p_enabled);
+
+	Dictionary space_get_interpolated_transforms(const RID& p_space, float p_alpha) const;
+
+	bool space_is_contact_stream_enabled(const RID& p_space) const;
+
+	void space_set_contact_stream_enabled(const RID& p_space, bool p_enabled);
+
+	Dictionary space_get_contact_stream(const RID& p_space) const;
+
+	PackedInt64Array bodies_create_batch(
+		const RID& p_space,
+		const RID& p_shape,
+		BodyMode p_mode,
+		const PackedFloat32Array& p_transforms,
+		uint32_t p_collision_layer,
+		uint32_t p_collision_mask
+	);
+
+	void area_set_body_monitor_batch_callback(const RID& p_area, const Callable& p_callback);
+
+	void area_set_area_monitor_batch_callback(const RID& p_area, const Callable& p_callback);
+
+	// Deliberately not bound, since it takes raw function pointers, see `jolt_batch_integrator.hpp`
+	void space_set_batch_integrator(
+		const RID& p_space,
+		JoltBatchIntegrator p_integrator,
+		void* p_userdata,
+		bool p_parallel
+	);
+
+	bool body_is_batch_integrated(const RID& p_body) const;
+
+	void body_set_batch_integrated(const RID& p_body, bool p_enabled);
+
+	bool body_is_parked(const RID& p_body) const;
+
+	void body_set_parked(const RID& p_body, bool p_enabled);
+
+	uint32_t body_get_contact_fields(const RID& p_body) const;
+
+	void body_set_contact_fields(const RID& p_body, uint32_t p_fields);
+
+	void bodies_set_transforms(
+		const PackedInt64Array& p_bodies,
+		const PackedFloat32Array& p_transforms,
+		bool p_activate
+	);
+
+	void bodies_set_velocities(
+		const PackedInt64Array& p_bodies,
+		const PackedFloat32Array& p_velocities,
+		bool p_activate
+	);
+
 	bool joint_get_enabled(const RID& p_joint) const;
 
 	void joint_set_enabled(const RID& p_joint, bool p_enabled);
@@ -741,6 +844,17 @@ public:
 	float generic_6dof_joint_get_applied_torque(const RID& p_joint);
 
 private:
+	static void _execute_step(void* p_user_data);
+
+	void _step_spaces(float p_step);
+
+	void _step_spaces_in_parallel(float p_step);
+
+	template<typename TCallback>
+	void _write_bodies(const PackedInt64Array& p_bodies, bool p_activate, TCallback&& p_callback);
+
+	JoltBodyImpl3D* _acquire_body();
+
 	mutable RID_PtrOwner<JoltSpace3D> space_owner;
 
 	mutable RID_PtrOwner<JoltAreaImpl3D> area_owner;
@@ -751,10 +865,20 @@ private:
 
 	mutable RID_PtrOwner<JoltJointImpl3D> joint_owner;
 
-	HashSet<JoltSpace3D*> active_spaces;
+	inline static thread_local bool stepping_thread = false;
+
+	LocalVector<JoltSpace3D*> active_spaces;
+
+	LocalVector<JoltBodyImpl3D*> body_pool;
 
 	JoltJobSystem* job_system = nullptr;
 
+	mutable std::atomic<int64_t> step_task_id = -1;
+
+	mutable std::mutex step_mutex;
+
+	float pending_step = 0.0f;
+
 	bool active = true;
 
 	bool flushing_queries = false;
@@ -768,3 +892,4 @@ VARIANT_ENUM_CAST(JoltPhysicsServer3D::ConeTwistJointParamJolt)
 VARIANT_ENUM_CAST(JoltPhysicsServer3D::ConeTwistJointFlagJolt)
 VARIANT_ENUM_CAST(JoltPhysicsServer3D::G6DOFJointAxisParamJolt)
 VARIANT_ENUM_CAST(JoltPhysicsServer3D::G6DOFJointAxisFlagJolt)
+VARIANT_ENUM_CAST(JoltPhysicsServer3D::BodyContactFieldJolt)
@@ -22,14 +22,23 @@ constexpr char ACTIVE_EDGE_THRESHOLD[] = "physics/jolt_3d/solver/active_edge_thr
 constexpr char BOUNCE_VELOCITY_THRESHOLD[] = "physics/jolt_3d/solver/bounce_velocity_threshold";
 constexpr char CONTACT_DISTANCE[] = "physics/jolt_3d/solver/contact_speculative_distance";
 constexpr char CONTACT_PENETRATION[] = "physics/jolt_3d/solver/contact_allowed_penetration";
+constexpr char COLLISION_STEPS[] = "physics/jolt_3d/solver/collision_steps";
+constexpr char ADAPTIVE_STEPS[] = "physics/jolt_3d/solver/adaptive_collision_steps";
+constexpr char ADAPTIVE_STEP_DISTANCE[] = "physics/jolt_3d/solver/adaptive_step_distance";
+constexpr char MAX_ADAPTIVE_STEPS[] = "physics/jolt_3d/solver/max_adaptive_collision_steps";
 
 constexpr char MAX_LINEAR_VELOCITY[] = "physics/jolt_3d/limits/max_linear_velocity";
 constexpr char MAX_ANGULAR_VELOCITY[] = "physics/jolt_3d/limits/max_angular_velocity";
 constexpr char MAX_BODIES[] = "physics/jolt_3d/limits/max_bodies";
+constexpr char MAX_POOLED_BODIES[] = "physics/jolt_3d/limits/max_pooled_bodies";
 constexpr char MAX_PAIRS[] = "physics/jolt_3d/limits/max_body_pairs";
 constexpr char MAX_CONTACTS[] = "physics/jolt_3d/limits/max_contact_constraints";
 constexpr char MAX_TEMP_MEMORY[] = "physics/jolt_3d/limits/max_temporary_memory";
 
+constexpr char PARALLEL_SPACES[] = "physics/jolt_3d/threading/step_spaces_in_parallel";
+constexpr char DEDICATED_THREADS[] = "physics/jolt_3d/threading/use_dedicated_threads";
+constexpr char DEDICATED_THREAD_COUNT[] = "physics/jolt_3d/threading/dedicated_thread_count";
+
 constexpr char RUN_ON_SEPARATE_THREAD[] = "physics/3d/run_on_separate_thread";
 constexpr char MAX_THREADS[] = "threading/worker_pool/max_threads";
 
@@ -134,13 +143,22 @@ void JoltProjectSettings::register_settings() {
 	register_setting_hinted(BOUNCE_VELOCITY_THRESHOLD, 1.0f, U"suffix:m/s");
 	register_setting_ranged(CONTACT_DISTANCE, 0.02f, U"0,1,0.001,or_greater,suffix:m");
 	register_setting_ranged(CONTACT_PENETRATION, 0.02f, U"0,1,0.001,or_greater,suffix:m");
+	register_setting_ranged(COLLISION_STEPS, 1, U"1,8,or_greater");
+	register_setting_plain(ADAPTIVE_STEPS, false);
+	register_setting_ranged(ADAPTIVE_STEP_DISTANCE, 0.25f, U"0.01,1,0.01,or_greater,suffix:m");
+	register_setting_ranged(MAX_ADAPTIVE_STEPS, 4, U"1,8,or_greater");
 
 	register_setting_ranged(MAX_LINEAR_VELOCITY, 500.0f, U"0,500,0.01,or_greater,suffix:m/s");
 	register_setting_ranged(MAX_ANGULAR_VELOCITY, 2700.0f, U"0,2700,0.01,or_greater,suffix:°/s");
 	register_setting_ranged(MAX_BODIES, 10240, U"1,10240,or_greater", true);
+	register_setting_ranged(MAX_POOLED_BODIES, 0, U"0,10240,or_greater", true);
 	register_setting_ranged(MAX_PAIRS, 65536, U"8,65536,or_greater");
 	register_setting_ranged(MAX_CONTACTS, 20480, U"8,20480,or_greater");
 	register_setting_ranged(MAX_TEMP_MEMORY, 32, U"1,32,or_greater,suffix:MiB");
+
+	register_setting_plain(PARALLEL_SPACES, false);
+	register_setting_plain(DEDICATED_THREADS, false, true);
+	register_setting_ranged(DEDICATED_THREAD_COUNT, 0, U"0,64,or_greater", true);
 }
 
 bool JoltProjectSettings::is_sleep_enabled() {
@@ -223,6 +241,26 @@ float JoltProjectSettings::get_contact_penetration() {
 	return value;
 }
 
+int32_t JoltProjectSettings::get_collision_steps() {
+	static const auto value = get_setting<int32_t>(COLLISION_STEPS);
+	return value;
+}
+
+bool JoltProjectSettings::use_adaptive_collision_steps() {
+	static const auto value = get_setting<bool>(ADAPTIVE_STEPS);
+	return value;
+}
+
+float JoltProjectSettings::get_adaptive_step_distance() {
+	static const auto value = get_setting<float>(ADAPTIVE_STEP_DISTANCE);
+	return value;
+}
+
+int32_t JoltProjectSettings::get_max_adaptive_collision_steps() {
+	static const auto value = get_setting<int32_t>(MAX_ADAPTIVE_STEPS);
+	return value;
+}
+
 float JoltProjectSettings::get_max_linear_velocity() {
 	static const auto value = get_setting<float>(MAX_LINEAR_VELOCITY);
 	return value;
@@ -238,6 +276,11 @@ int32_t JoltProjectSettings::get_max_bodies() {
 	return value;
 }
 
+int32_t JoltProjectSettings::get_max_pooled_bodies() {
+	static const auto value = get_setting<int32_t>(MAX_POOLED_BODIES);
+	return value;
+}
+
 int32_t JoltProjectSettings::get_max_body_pairs() {
 	static const auto value = get_setting<int32_t>(MAX_PAIRS);
 	return value;
@@ -258,6 +301,21 @@ int64_t JoltProjectSettings::get_max_temp_memory_b() {
 	return value;
 }
 
+bool JoltProjectSettings::should_step_spaces_in_parallel() {
+	static const auto value = get_setting<bool>(PARALLEL_SPACES);
+	return value;
+}
+
+bool JoltProjectSettings::use_dedicated_threads() {
+	static const auto value = get_setting<bool>(DEDICATED_THREADS);
+	return value;
+}
+
+int32_t JoltProjectSettings::get_dedicated_thread_count() {
+	static const auto value = get_setting<int32_t>(DEDICATED_THREAD_COUNT);
+	return value;
+}
+
 bool JoltProjectSettings::should_run_on_separate_thread() {
 	static const auto value = get_setting<bool>(RUN_ON_SEPARATE_THREAD);
 	return value;
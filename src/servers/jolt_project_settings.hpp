@@ -36,12 +36,22 @@ public:
 
 	static float get_contact_penetration();
 
+	static int32_t get_collision_steps();
+
+	static bool use_adaptive_collision_steps();
+
+	static float get_adaptive_step_distance();
+
+	static int32_t get_max_adaptive_collision_steps();
+
 	static float get_max_linear_velocity();
 
 	static float get_max_angular_velocity();
 
 	static int32_t get_max_bodies();
 
+	static int32_t get_max_pooled_bodies();
+
 	static int32_t get_max_body_pairs();
 
 	static int32_t get_max_contact_constraints();
@@ -50,6 +60,12 @@ public:
 
 	static int64_t get_max_temp_memory_b();
 
+	static bool should_step_spaces_in_parallel();
+
+	static bool use_dedicated_threads();
+
+	static int32_t get_dedicated_thread_count();
+
 	static bool should_run_on_separate_thread();
 
 	static int32_t get_max_threads();
@@ -0,0 +1,106 @@
+#include "jolt_tracer.hpp"
+
+uint64_t JoltTracer::get_time_nsec() {
+	using Clock = std::chrono::steady_clock;
+	using Nanoseconds = std::chrono::nanoseconds;
+
+	const Clock::duration time = Clock::now().time_since_epoch();
+	return (uint64_t)std::chrono::duration_cast<Nanoseconds>(time).count();
+}
+
+void JoltTracer::record(const char* p_name, uint64_t p_start_nsec, uint64_t p_end_nsec) {
+	ThreadBuffer& buffer = _get_thread_buffer();
+
+	// Each buffer only ever has the one thread writing to it, so all we need to do is make sure the
+	// event is written before the count is bumped, for the sake of whoever ends up reading it
+	const uint32_t event_count = buffer.event_count.load(std::memory_order_relaxed);
+
+	Event& event = buffer.events[event_count % BUFFER_CAPACITY];
+	event.name = p_name;
+	event.start_nsec = p_start_nsec;
+	event.end_nsec = p_end_nsec;
+
+	buffer.event_count.store(event_count + 1, std::memory_order_release);
+}
+
+void JoltTracer::clear() {
+	const std::lock_guard buffers_lock(thread_buffers_mutex);
+
+	for (ThreadBuffer* buffer : thread_buffers) {
+		buffer->event_count = 0;
+	}
+}
+
+Error JoltTracer::dump(const String& p_path) {
+	Ref<FileAccess> file_access = FileAccess::open(p_path, FileAccess::ModeFlags::WRITE);
+
+	ERR_FAIL_NULL_V_MSG(
+		file_access,
+		FileAccess::get_open_error(),
+		vformat("Failed to open '%s' for writing when dumping physics trace.", p_path)
+	);
+
+	const int32_t process_id = OS::get_singleton()->get_process_id();
+
+	file_access->store_string("{\"traceEvents\":[\n");
+
+	bool first_event = true;
+
+	const std::lock_guard buffers_lock(thread_buffers_mutex);
+
+	for (const ThreadBuffer* buffer : thread_buffers) {
+		const uint32_t event_count = buffer->event_count.load(std::memory_order_acquire);
+		const uint32_t first_index = event_count > BUFFER_CAPACITY
+			? event_count - BUFFER_CAPACITY
+			: 0;
+
+		for (uint32_t i = first_index; i < event_count; ++i) {
+			const Event& event = buffer->events[i % BUFFER_CAPACITY];
+
+			const double start_usec = (double)event.start_nsec / 1000.0;
+			const double duration_usec = (double)(event.end_nsec - event.start_nsec) / 1000.0;
+
+			file_access->store_string(vformat(
+				"%s{\"name\":\"%s\",\"cat\":\"physics\",\"ph\":\"X\","
+				"\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}",
+				first_event ? "" : ",\n",
+				event.name,
+				start_usec,
+				duration_usec,
+				process_id,
+				buffer->thread_index
+			));
+
+			first_event = false;
+		}
+	}
+
+	file_access->store_string("\n]}\n");
+
+	ERR_FAIL_COND_V_MSG(
+		file_access->get_error() != OK,
+		file_access->get_error(),
+		vformat(
+			"Writing physics trace to '%s' failed with error '%s'.",
+			p_path,
+			UtilityFunctions::error_string(file_access->get_error())
+		)
+	);
+
+	return OK;
+}
+
+JoltTracer::ThreadBuffer& JoltTracer::_get_thread_buffer() {
+	if (thread_buffer == nullptr) {
+		// These are never freed, since threads could be holding on to them for as long as they
+		// live, but they're only ever allocated once per thread and only when tracing is enabled
+		thread_buffer = new ThreadBuffer();
+
+		const std::lock_guard buffers_lock(thread_buffers_mutex);
+
+		thread_buffer->thread_index = thread_buffers.size();
+		thread_buffers.push_back(thread_buffer);
+	}
+
+	return *thread_buffer;
+}
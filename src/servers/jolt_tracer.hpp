@@ -0,0 +1,77 @@
+#pragma once
+
+class JoltTracer {
+public:
+	static bool is_enabled() { return enabled.load(std::memory_order_relaxed); }
+
+	static void set_enabled(bool p_enabled) { enabled = p_enabled; }
+
+	static uint64_t get_time_nsec();
+
+	static void record(const char* p_name, uint64_t p_start_nsec, uint64_t p_end_nsec);
+
+	static void clear();
+
+	static Error dump(const String& p_path);
+
+private:
+	static constexpr uint32_t BUFFER_CAPACITY = 8192;
+
+	struct Event {
+		const char* name = nullptr;
+
+		uint64_t start_nsec = 0;
+
+		uint64_t end_nsec = 0;
+	};
+
+	struct ThreadBuffer {
+		Event events[BUFFER_CAPACITY];
+
+		std::atomic<uint32_t> event_count = 0;
+
+		int32_t thread_index = 0;
+	};
+
+	static ThreadBuffer& _get_thread_buffer();
+
+	inline static thread_local ThreadBuffer* thread_buffer = nullptr;
+
+	inline static LocalVector<ThreadBuffer*> thread_buffers;
+
+	inline static std::mutex thread_buffers_mutex;
+
+	inline static std::atomic<bool> enabled = false;
+};
+
+class JoltTraceScope {
+public:
+	explicit JoltTraceScope(const char* p_name)
+		: name(p_name)
+		, active(JoltTracer::is_enabled()) {
+		if (active) {
+			start_nsec = JoltTracer::get_time_nsec();
+		}
+	}
+
+	JoltTraceScope(const JoltTraceScope& p_other) = delete;
+
+	JoltTraceScope(JoltTraceScope&& p_other) = delete;
+
+	~JoltTraceScope() {
+		if (active) {
+			JoltTracer::record(name, start_nsec, JoltTracer::get_time_nsec());
+		}
+	}
+
+	JoltTraceScope& operator=(const JoltTraceScope& p_other) = delete;
+
+	JoltTraceScope& operator=(JoltTraceScope&& p_other) = delete;
+
+private:
+	const char* name = nullptr;
+
+	uint64_t start_nsec = 0;
+
+	bool active = false;
+};
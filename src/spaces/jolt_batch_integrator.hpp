@@ -0,0 +1,50 @@
+#pragma once
+
+// This is the interface that native code (like another GDExtension) can use to integrate forces for
+// many bodies at once, by registering a function through `godot_jolt_space_set_batch_integrator`,
+// which is exported from the Godot Jolt library. The layout only uses plain C types, so that it can
+// be mirrored by code that doesn't include this header.
+//
+// All vector arrays hold 3 floats per body. Velocities are read back into the bodies after the
+// integrator returns, and any forces or torques written are applied for the coming step.
+//
+// By the time the integrator is called, the linear velocities already include this step's gravity
+// (unless the body uses a custom integrator) and the body's constant force and torque have already
+// been added, so the forces and torques written here are applied on top of those.
+//
+// The integrator runs as part of the step, which can be on a worker thread (or several, if it's
+// parallel), so it should stick to the data it's given. Calling into `JoltPhysicsServer3D` from it
+// won't wait for the step to finish, so it will see the bodies mid-step, and may deadlock on the
+// body locks held by the step.
+struct JoltBatchIntegration {
+	const int64_t* bodies;
+
+	const float* positions;
+
+	const float* gravities;
+
+	float* linear_velocities;
+
+	float* angular_velocities;
+
+	float* forces;
+
+	float* torques;
+
+	int32_t body_count;
+
+	float step;
+};
+
+using JoltBatchIntegrator = void (*)(JoltBatchIntegration* p_batch, void* p_userdata);
+
+// Sets (or clears, if `p_integrator` is null) the batch integrator of the space whose RID has ID
+// `p_space`, returning whether it succeeded. This is intentionally not exposed to scripts, since
+// letting them pass function pointers would let them call into arbitrary memory. It must be called
+// from the main thread.
+extern "C" GDE_EXPORT bool godot_jolt_space_set_batch_integrator(
+	int64_t p_space,
+	JoltBatchIntegrator p_integrator,
+	void* p_userdata,
+	bool p_parallel
+);
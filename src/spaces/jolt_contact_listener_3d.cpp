@@ -2,28 +2,78 @@
 
 #include "objects/jolt_area_impl_3d.hpp"
 #include "objects/jolt_body_impl_3d.hpp"
+#include "servers/jolt_physics_server_3d.hpp"
 #include "servers/jolt_project_settings.hpp"
+#include "servers/jolt_tracer.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
-void JoltContactListener3D::listen_for(JoltObjectImpl3D* p_object) {
-	listening_for.insert(p_object->get_jolt_id());
+namespace {
+
+// Any thread past this number will share a single buffer that's guarded by a mutex instead
+constexpr int32_t MAX_THREAD_BUFFERS = 128;
+
+} // namespace
+
+JoltContactListener3D::JoltContactListener3D(JoltSpace3D* p_space)
+	: space(p_space) {
+	listening_for.resize((JoltProjectSettings::get_max_bodies() + 63) / 64);
+
+	for (uint64_t& bits : listening_for) {
+		bits = 0;
+	}
+
+	thread_buffers.resize(MAX_THREAD_BUFFERS);
+
+	for (ThreadBuffer*& buffer : thread_buffers) {
+		buffer = nullptr;
+	}
 }
 
-void JoltContactListener3D::pre_step() {
-	listening_for.clear();
+JoltContactListener3D::~JoltContactListener3D() {
+	for (ThreadBuffer* buffer : thread_buffers) {
+		delete buffer;
+	}
+}
+
+void JoltContactListener3D::listen_for(const JPH::BodyID& p_body_id) {
+	ERR_FAIL_COND(p_body_id.IsInvalid());
 
+	const JPH::uint32 index = p_body_id.GetIndex();
+	listening_for[index / 64] |= uint64_t(1) << (index % 64);
+}
+
+void JoltContactListener3D::stop_listening_for(const JPH::BodyID& p_body_id) {
+	ERR_FAIL_COND(p_body_id.IsInvalid());
+
+	const JPH::uint32 index = p_body_id.GetIndex();
+	listening_for[index / 64] &= ~(uint64_t(1) << (index % 64));
+}
+
+void JoltContactListener3D::pre_step() {
 #ifdef GDJ_CONFIG_EDITOR
 	debug_contact_count = 0;
 #endif // GDJ_CONFIG_EDITOR
 }
 
-void JoltContactListener3D::post_step() {
+void JoltContactListener3D::post_step(const JPH::BodyID* p_swapped_ids, int32_t p_swapped_count) {
 	_flush_contacts();
-	_flush_area_shifts();
+	_flush_area_overlaps();
+	_flush_area_shifts(p_swapped_ids, p_swapped_count);
 	_flush_area_exits();
 	_flush_area_enters();
 }
 
+void JoltContactListener3D::set_contact_stream_enabled(bool p_enabled) {
+	contact_stream_enabled = p_enabled;
+
+	if (!contact_stream_enabled) {
+		contact_stream = {};
+		stream_manifolds.clear();
+		stream_cursors.clear();
+		stream_ranges_by_body.clear();
+	}
+}
+
 void JoltContactListener3D::OnContactAdded(
 	const JPH::Body& p_body1,
 	const JPH::Body& p_body2,
@@ -57,13 +107,14 @@ void JoltContactListener3D::OnContactPersisted(
 }
 
 void JoltContactListener3D::OnContactRemoved(const JPH::SubShapeIDPair& p_shape_pair) {
-	if (!_try_remove_contacts(p_shape_pair)) {
-		_try_remove_area_overlap(p_shape_pair);
-	}
+	// We don't know whether this pair involves an area without looking up the bodies, so we leave
+	// it to `_flush_area_overlaps` to figure out if this actually removes an overlap
+	_write_overlap_event(p_shape_pair, OVERLAP_EVENT_REMOVED);
 }
 
 bool JoltContactListener3D::_is_listening_for(const JPH::Body& p_body) const {
-	return listening_for.has(p_body.GetID());
+	const JPH::uint32 index = p_body.GetID().GetIndex();
+	return ((listening_for[index / 64] >> (index % 64)) & 1) != 0;
 }
 
 bool JoltContactListener3D::_try_override_collision_response(
@@ -156,10 +207,27 @@ bool JoltContactListener3D::_try_add_contacts(
 		return false;
 	}
 
-	if (!_is_listening_for(p_body1) && !_is_listening_for(p_body2)) {
+	const bool listening1 = _is_listening_for(p_body1);
+	const bool listening2 = _is_listening_for(p_body2);
+
+	if (!listening1 && !listening2) {
 		return false;
 	}
 
+	const auto* body1 = reinterpret_cast<const JoltBodyImpl3D*>(p_body1.GetUserData());
+	const auto* body2 = reinterpret_cast<const JoltBodyImpl3D*>(p_body2.GetUserData());
+
+	// We only compute the fields that are actually wanted by either of the bodies
+	uint32_t contact_fields = 0;
+	contact_fields |= listening1 ? body1->get_contact_fields() : 0;
+	contact_fields |= listening2 ? body2->get_contact_fields() : 0;
+
+	const bool wants_velocities =
+		(contact_fields & JoltPhysicsServer3D::BODY_CONTACT_FIELD_VELOCITIES) != 0;
+
+	const bool wants_impulses =
+		(contact_fields & JoltPhysicsServer3D::BODY_CONTACT_FIELD_IMPULSES) != 0;
+
 	const JPH::SubShapeIDPair shape_pair(
 		p_body1.GetID(),
 		p_manifold.mSubShapeID1,
@@ -167,64 +235,86 @@ bool JoltContactListener3D::_try_add_contacts(
 		p_manifold.mSubShapeID2
 	);
 
-	auto& manifold = [&]() -> Manifold& {
-		const MutexLock write_lock(write_mutex);
-		return manifolds_by_shape_pair[shape_pair];
-	}();
-
 	const JPH::uint contact_count = p_manifold.mRelativeContactPointsOn1.size();
 
-	manifold.contacts1.reserve((int32_t)contact_count);
-	manifold.contacts2.reserve((int32_t)contact_count);
-	manifold.depth = p_manifold.mPenetrationDepth;
-
 	JPH::CollisionEstimationResult collision;
 
-	JPH::EstimateCollisionResponse(
-		p_body1,
-		p_body2,
-		p_manifold,
-		collision,
-		p_settings.mCombinedFriction,
-		p_settings.mCombinedRestitution,
-		JoltProjectSettings::get_bounce_velocity_threshold(),
-		5
-	);
+	if (wants_impulses) {
+		JPH::EstimateCollisionResponse(
+			p_body1,
+			p_body2,
+			p_manifold,
+			collision,
+			p_settings.mCombinedFriction,
+			p_settings.mCombinedRestitution,
+			JoltProjectSettings::get_bounce_velocity_threshold(),
+			5
+		);
+	}
 
-	for (JPH::uint i = 0; i < contact_count; ++i) {
-		Contact& contact1 = manifold.contacts1.emplace_back();
-		Contact& contact2 = manifold.contacts2.emplace_back();
+	const uint64_t sequence = next_event_sequence.fetch_add(1, std::memory_order_relaxed);
 
-		const JPH::Vec3& relative_point1 = p_manifold.mRelativeContactPointsOn1[i];
-		const JPH::Vec3& relative_point2 = p_manifold.mRelativeContactPointsOn2[i];
+	_write_to_thread_buffer([&](ThreadBuffer& p_buffer) {
+		Manifold& manifold = p_buffer.manifolds.emplace_back();
+		manifold.shape_pair = shape_pair;
+		manifold.sequence = sequence;
+		manifold.depth = p_manifold.mPenetrationDepth;
+		manifold.contact_offset = p_buffer.contacts1.size();
+		manifold.contact_count = (int32_t)contact_count;
 
-		const JPH::Vec3 world_point1 = p_manifold.mBaseOffset + relative_point1;
-		const JPH::Vec3 world_point2 = p_manifold.mBaseOffset + relative_point2;
+		p_buffer.contacts1.resize(manifold.contact_offset + manifold.contact_count);
+		p_buffer.contacts2.resize(manifold.contact_offset + manifold.contact_count);
 
-		const JPH::Vec3 velocity1 = p_body1.GetPointVelocity(world_point1);
-		const JPH::Vec3 velocity2 = p_body2.GetPointVelocity(world_point2);
+		Contact* contacts1 = p_buffer.contacts1.ptr() + manifold.contact_offset;
+		Contact* contacts2 = p_buffer.contacts2.ptr() + manifold.contact_offset;
 
-		const JPH::CollisionEstimationResult::Impulse& impulse = collision.mImpulses[i];
+		for (JPH::uint i = 0; i < contact_count; ++i) {
+			Contact& contact1 = contacts1[i];
+			Contact& contact2 = contacts2[i];
 
-		const JPH::Vec3 contact_impulse = p_manifold.mWorldSpaceNormal * impulse.mContactImpulse;
-		const JPH::Vec3 friction_impulse1 = collision.mTangent1 * impulse.mFrictionImpulse1;
-		const JPH::Vec3 friction_impulse2 = collision.mTangent2 * impulse.mFrictionImpulse2;
-		const JPH::Vec3 combined_impulse = contact_impulse + friction_impulse1 + friction_impulse2;
+			const JPH::Vec3& relative_point1 = p_manifold.mRelativeContactPointsOn1[i];
+			const JPH::Vec3& relative_point2 = p_manifold.mRelativeContactPointsOn2[i];
 
-		contact1.normal = -p_manifold.mWorldSpaceNormal;
-		contact1.point_self = world_point1;
-		contact1.point_other = world_point2;
-		contact1.velocity_self = velocity1;
-		contact1.velocity_other = velocity2;
-		contact1.impulse = -combined_impulse;
+			const JPH::Vec3 world_point1 = p_manifold.mBaseOffset + relative_point1;
+			const JPH::Vec3 world_point2 = p_manifold.mBaseOffset + relative_point2;
 
-		contact2.normal = p_manifold.mWorldSpaceNormal;
-		contact2.point_self = world_point2;
-		contact2.point_other = world_point1;
-		contact2.velocity_self = velocity2;
-		contact2.velocity_other = velocity1;
-		contact2.impulse = combined_impulse;
-	}
+			JPH::Vec3 velocity1 = JPH::Vec3::sZero();
+			JPH::Vec3 velocity2 = JPH::Vec3::sZero();
+
+			if (wants_velocities) {
+				velocity1 = p_body1.GetPointVelocity(world_point1);
+				velocity2 = p_body2.GetPointVelocity(world_point2);
+			}
+
+			JPH::Vec3 combined_impulse = JPH::Vec3::sZero();
+
+			if (wants_impulses) {
+				const JPH::CollisionEstimationResult::Impulse& impulse = collision.mImpulses[i];
+
+				const JPH::Vec3 normal_impulse = p_manifold.mWorldSpaceNormal *
+					impulse.mContactImpulse;
+
+				const JPH::Vec3 friction_impulse1 = collision.mTangent1 * impulse.mFrictionImpulse1;
+				const JPH::Vec3 friction_impulse2 = collision.mTangent2 * impulse.mFrictionImpulse2;
+
+				combined_impulse = normal_impulse + friction_impulse1 + friction_impulse2;
+			}
+
+			contact1.normal = -p_manifold.mWorldSpaceNormal;
+			contact1.point_self = world_point1;
+			contact1.point_other = world_point2;
+			contact1.velocity_self = velocity1;
+			contact1.velocity_other = velocity2;
+			contact1.impulse = -combined_impulse;
+
+			contact2.normal = p_manifold.mWorldSpaceNormal;
+			contact2.point_self = world_point2;
+			contact2.point_other = world_point1;
+			contact2.velocity_self = velocity2;
+			contact2.velocity_other = velocity1;
+			contact2.impulse = combined_impulse;
+		}
+	});
 
 	return true;
 }
@@ -241,18 +331,12 @@ bool JoltContactListener3D::_try_evaluate_area_overlap(
 	const bool is_actually_overlapping = p_manifold.mPenetrationDepth >= 0.0f;
 
 	auto evaluate = [&](auto&& p_area, auto&& p_object, const JPH::SubShapeIDPair& p_shape_pair) {
-		const MutexLock write_lock(write_mutex);
+		const bool overlapping = is_actually_overlapping && p_area.can_monitor(p_object);
 
-		if (is_actually_overlapping && p_area.can_monitor(p_object)) {
-			if (!area_overlaps.has(p_shape_pair)) {
-				area_overlaps.insert(p_shape_pair);
-				area_enters.insert(p_shape_pair);
-			}
-		} else {
-			if (area_overlaps.erase(p_shape_pair)) {
-				area_exits.insert(p_shape_pair);
-			}
-		}
+		_write_overlap_event(
+			p_shape_pair,
+			overlapping ? OVERLAP_EVENT_OVERLAPPING : OVERLAP_EVENT_SEPARATED
+		);
 	};
 
 	const JPH::SubShapeIDPair shape_pair1(
@@ -290,35 +374,49 @@ bool JoltContactListener3D::_try_evaluate_area_overlap(
 	return true;
 }
 
-bool JoltContactListener3D::_try_remove_contacts(const JPH::SubShapeIDPair& p_shape_pair) {
-	const MutexLock write_lock(write_mutex);
-
-	return manifolds_by_shape_pair.erase(p_shape_pair);
-}
-
-bool JoltContactListener3D::_try_remove_area_overlap(const JPH::SubShapeIDPair& p_shape_pair) {
-	const JPH::SubShapeIDPair swapped_shape_pair(
-		p_shape_pair.GetBody2ID(),
-		p_shape_pair.GetSubShapeID2(),
-		p_shape_pair.GetBody1ID(),
-		p_shape_pair.GetSubShapeID1()
-	);
+template<typename TCallback>
+void JoltContactListener3D::_write_to_thread_buffer(TCallback&& p_callback) {
+	if (thread_slot == -1) {
+		thread_slot = thread_slot_count++;
+	}
 
-	const MutexLock write_lock(write_mutex);
+	if (thread_slot < MAX_THREAD_BUFFERS) {
+		ThreadBuffer*& buffer = thread_buffers[thread_slot];
 
-	bool removed = false;
+		if (buffer == nullptr) {
+			buffer = new ThreadBuffer();
+		}
 
-	if (area_overlaps.erase(p_shape_pair)) {
-		area_exits.insert(p_shape_pair);
-		removed = true;
+		p_callback(*buffer);
+	} else {
+		const MutexLock shared_buffer_lock(shared_buffer_mutex);
+		p_callback(shared_buffer);
 	}
+}
 
-	if (area_overlaps.erase(swapped_shape_pair)) {
-		area_exits.insert(swapped_shape_pair);
-		removed = true;
+void JoltContactListener3D::_write_overlap_event(
+	const JPH::SubShapeIDPair& p_shape_pair,
+	OverlapEventType p_type
+) {
+	const uint64_t sequence = next_event_sequence.fetch_add(1, std::memory_order_relaxed);
+
+	_write_to_thread_buffer([&](ThreadBuffer& p_buffer) {
+		OverlapEvent& event = p_buffer.overlap_events.emplace_back();
+		event.shape_pair = p_shape_pair;
+		event.sequence = sequence;
+		event.type = p_type;
+	});
+}
+
+template<typename TCallback>
+void JoltContactListener3D::_for_each_thread_buffer(TCallback&& p_callback) {
+	for (ThreadBuffer* buffer : thread_buffers) {
+		if (buffer != nullptr) {
+			p_callback(*buffer);
+		}
 	}
 
-	return removed;
+	p_callback(shared_buffer);
 }
 
 #ifdef GDJ_CONFIG_EDITOR
@@ -369,8 +467,75 @@ bool JoltContactListener3D::_try_add_debug_contacts(
 
 #endif // GDJ_CONFIG_EDITOR
 
+void JoltContactListener3D::_gather_manifolds() {
+	latest_manifolds.clear();
+	ordered_manifolds.clear();
+
+	// With multiple collision steps the same shape pair gets reported once per collision step, so
+	// we only keep the most recent manifold of each pair.
+	_for_each_thread_buffer([&](ThreadBuffer& p_buffer) {
+		for (const Manifold& manifold : p_buffer.manifolds) {
+			LatestManifold* latest = latest_manifolds.getptr(manifold.shape_pair);
+
+			if (latest == nullptr) {
+				latest_manifolds.insert(manifold.shape_pair, {&manifold, &p_buffer});
+			} else if (latest->manifold->sequence < manifold.sequence) {
+				latest->manifold = &manifold;
+				latest->buffer = &p_buffer;
+			}
+		}
+	});
+
+	if (latest_manifolds.is_empty()) {
+		return;
+	}
+
+	// A pair that was removed in a later collision step than the one it was last reported in is no
+	// longer in contact by the end of the step, so we drop it.
+	_for_each_thread_buffer([&](ThreadBuffer& p_buffer) {
+		for (const OverlapEvent& event : p_buffer.overlap_events) {
+			if (event.type != OVERLAP_EVENT_REMOVED) {
+				continue;
+			}
+
+			LatestManifold* latest = latest_manifolds.getptr(event.shape_pair);
+
+			if (latest != nullptr && latest->manifold->sequence < event.sequence) {
+				latest->removed = true;
+			}
+		}
+	});
+
+	for (const auto& [shape_pair, latest] : latest_manifolds) {
+		if (!latest.removed) {
+			ordered_manifolds.push_back(latest);
+		}
+	}
+
+	// The order of the hash map is arbitrary, so we sort them to keep the contacts in the order
+	// they were reported in.
+	std::sort(
+		ordered_manifolds.begin(),
+		ordered_manifolds.end(),
+		[](const LatestManifold& p_lhs, const LatestManifold& p_rhs) {
+			return p_lhs.manifold->sequence < p_rhs.manifold->sequence;
+		}
+	);
+}
+
 void JoltContactListener3D::_flush_contacts() {
-	for (auto&& [shape_pair, manifold] : manifolds_by_shape_pair) {
+	const JoltTraceScope trace_scope("JoltContactListener3D::_flush_contacts");
+
+	stream_manifolds.clear();
+
+	_gather_manifolds();
+
+	for (const LatestManifold& latest : ordered_manifolds) {
+		const Manifold& manifold = *latest.manifold;
+		const ThreadBuffer& buffer = *latest.buffer;
+
+		const JPH::SubShapeIDPair& shape_pair = manifold.shape_pair;
+
 		const JPH::BodyID body_ids[] = {shape_pair.GetBody1ID(), shape_pair.GetBody2ID()};
 
 		const JoltReadableBodies3D jolt_bodies = space->read_bodies(
@@ -380,15 +545,31 @@ void JoltContactListener3D::_flush_contacts() {
 		);
 
 		JoltBodyImpl3D* body1 = jolt_bodies[0].as_body();
-		ERR_FAIL_NULL(body1);
+		ERR_CONTINUE(body1 == nullptr);
 
 		JoltBodyImpl3D* body2 = jolt_bodies[1].as_body();
-		ERR_FAIL_NULL(body2);
+		ERR_CONTINUE(body2 == nullptr);
 
 		const int32_t shape_index1 = body1->find_shape_index(shape_pair.GetSubShapeID1());
 		const int32_t shape_index2 = body2->find_shape_index(shape_pair.GetSubShapeID2());
 
-		for (const Contact& contact : manifold.contacts1) {
+		const Contact* contacts1 = buffer.contacts1.ptr() + manifold.contact_offset;
+		const Contact* contacts2 = buffer.contacts2.ptr() + manifold.contact_offset;
+
+		if (contact_stream_enabled) {
+			StreamManifold& stream_manifold = stream_manifolds.emplace_back();
+			stream_manifold.body1 = body1;
+			stream_manifold.body2 = body2;
+			stream_manifold.contacts1 = contacts1;
+			stream_manifold.contacts2 = contacts2;
+			stream_manifold.shape_index1 = shape_index1;
+			stream_manifold.shape_index2 = shape_index2;
+			stream_manifold.contact_count = manifold.contact_count;
+		}
+
+		for (int32_t i = 0; i < manifold.contact_count; ++i) {
+			const Contact& contact = contacts1[i];
+
 			body1->add_contact(
 				body2,
 				manifold.depth,
@@ -403,7 +584,9 @@ void JoltContactListener3D::_flush_contacts() {
 			);
 		}
 
-		for (const Contact& contact : manifold.contacts2) {
+		for (int32_t i = 0; i < manifold.contact_count; ++i) {
+			const Contact& contact = contacts2[i];
+
 			body2->add_contact(
 				body1,
 				manifold.depth,
@@ -417,13 +600,201 @@ void JoltContactListener3D::_flush_contacts() {
 				to_godot(contact.impulse)
 			);
 		}
+	}
 
-		manifold.contacts1.clear();
-		manifold.contacts2.clear();
+	if (contact_stream_enabled) {
+		_flush_contact_stream();
 	}
+
+	_for_each_thread_buffer([&](ThreadBuffer& p_buffer) {
+		p_buffer.manifolds.clear();
+		p_buffer.contacts1.clear();
+		p_buffer.contacts2.clear();
+	});
+}
+
+void JoltContactListener3D::_flush_contact_stream() {
+	const JoltTraceScope trace_scope("JoltContactListener3D::_flush_contact_stream");
+
+	stream_ranges_by_body.clear();
+	stream_cursors.clear();
+
+	// We do a counting sort on the contacts, first by counting how many contacts each body has, so
+	// that every contact can then be written directly to its final position in the stream.
+
+	auto count_contacts = [&](JoltBodyImpl3D* p_body, int32_t p_count) {
+		if (!p_body->generates_contacts()) {
+			return;
+		}
+
+		if (const int32_t* range_index = stream_ranges_by_body.getptr(p_body)) {
+			stream_cursors[*range_index] += p_count;
+		} else {
+			stream_ranges_by_body.insert(p_body, stream_cursors.size());
+			stream_cursors.push_back(p_count);
+		}
+	};
+
+	for (const StreamManifold& manifold : stream_manifolds) {
+		count_contacts(manifold.body1, manifold.contact_count);
+		count_contacts(manifold.body2, manifold.contact_count);
+	}
+
+	const int32_t range_count = stream_cursors.size();
+
+	contact_stream.bodies.resize(range_count);
+	contact_stream.body_offsets.resize(range_count);
+	contact_stream.body_counts.resize(range_count);
+
+	int64_t* bodies = contact_stream.bodies.ptrw();
+	int32_t* body_offsets = contact_stream.body_offsets.ptrw();
+	int32_t* body_counts = contact_stream.body_counts.ptrw();
+
+	int32_t total_count = 0;
+
+	for (auto&& [body, range_index] : stream_ranges_by_body) {
+		const int32_t count = stream_cursors[range_index];
+
+		bodies[range_index] = body->get_rid().get_id();
+		body_offsets[range_index] = total_count;
+		body_counts[range_index] = count;
+
+		stream_cursors[range_index] = total_count;
+		total_count += count;
+	}
+
+	contact_stream.colliders.resize(total_count);
+	contact_stream.shapes.resize(total_count);
+	contact_stream.collider_shapes.resize(total_count);
+	contact_stream.points.resize(total_count);
+	contact_stream.normals.resize(total_count);
+	contact_stream.impulses.resize(total_count);
+
+	int64_t* colliders = contact_stream.colliders.ptrw();
+	int32_t* shapes = contact_stream.shapes.ptrw();
+	int32_t* collider_shapes = contact_stream.collider_shapes.ptrw();
+	Vector3* points = contact_stream.points.ptrw();
+	Vector3* normals = contact_stream.normals.ptrw();
+	Vector3* impulses = contact_stream.impulses.ptrw();
+
+	auto write_contacts = [&](const StreamManifold& p_manifold, bool p_swapped) {
+		JoltBodyImpl3D* body = p_swapped ? p_manifold.body2 : p_manifold.body1;
+		const JoltBodyImpl3D* collider = p_swapped ? p_manifold.body1 : p_manifold.body2;
+
+		const int32_t* range_index = stream_ranges_by_body.getptr(body);
+
+		if (range_index == nullptr) {
+			return;
+		}
+
+		const int32_t shape_index = p_swapped ? p_manifold.shape_index2 : p_manifold.shape_index1;
+		const int32_t collider_shape_index = p_swapped
+			? p_manifold.shape_index1
+			: p_manifold.shape_index2;
+
+		const Contact* contacts = p_swapped ? p_manifold.contacts2 : p_manifold.contacts1;
+
+		const int64_t collider_rid = collider->get_rid().get_id();
+
+		int32_t& cursor = stream_cursors[*range_index];
+
+		for (int32_t i = 0; i < p_manifold.contact_count; ++i) {
+			const Contact& contact = contacts[i];
+
+			colliders[cursor] = collider_rid;
+			shapes[cursor] = shape_index;
+			collider_shapes[cursor] = collider_shape_index;
+			points[cursor] = to_godot(contact.point_self);
+			normals[cursor] = to_godot(contact.normal);
+			impulses[cursor] = to_godot(contact.impulse);
+
+			++cursor;
+		}
+	};
+
+	for (const StreamManifold& manifold : stream_manifolds) {
+		write_contacts(manifold, false);
+		write_contacts(manifold, true);
+	}
+
+	stream_manifolds.clear();
+}
+
+void JoltContactListener3D::_flush_area_overlaps() {
+	const JoltTraceScope trace_scope("JoltContactListener3D::_flush_area_overlaps");
+
+	// Jolt only reports a pair as removed if it wasn't added or persisted during the same collision
+	// step, but with multiple collision steps per step a pair can be removed in one and added back
+	// in the next, so the events from all threads need to be applied in the order they happened.
+	_for_each_thread_buffer([&](ThreadBuffer& p_buffer) {
+		for (const OverlapEvent& event : p_buffer.overlap_events) {
+			ordered_overlap_events.push_back(event);
+		}
+
+		p_buffer.overlap_events.clear();
+	});
+
+	std::sort(
+		ordered_overlap_events.begin(),
+		ordered_overlap_events.end(),
+		[](const OverlapEvent& p_lhs, const OverlapEvent& p_rhs) {
+			return p_lhs.sequence < p_rhs.sequence;
+		}
+	);
+
+	// An overlap that's lost and then regained (or the other way around) within the same step
+	// cancels out, rather than being reported as both an exit and an enter.
+
+	const auto add_overlap = [&](const JPH::SubShapeIDPair& p_shape_pair) {
+		if (area_overlaps.has(p_shape_pair)) {
+			return;
+		}
+
+		_add_area_overlap(p_shape_pair);
+
+		if (!area_exits.erase(p_shape_pair)) {
+			area_enters.insert(p_shape_pair);
+		}
+	};
+
+	const auto remove_overlap = [&](const JPH::SubShapeIDPair& p_shape_pair) {
+		if (!_remove_area_overlap(p_shape_pair)) {
+			return;
+		}
+
+		if (!area_enters.erase(p_shape_pair)) {
+			area_exits.insert(p_shape_pair);
+		}
+	};
+
+	for (const OverlapEvent& event : ordered_overlap_events) {
+		const JPH::SubShapeIDPair& shape_pair = event.shape_pair;
+
+		switch (event.type) {
+			case OVERLAP_EVENT_OVERLAPPING: {
+				add_overlap(shape_pair);
+			} break;
+			case OVERLAP_EVENT_SEPARATED: {
+				remove_overlap(shape_pair);
+			} break;
+			case OVERLAP_EVENT_REMOVED: {
+				remove_overlap(shape_pair);
+				remove_overlap(JPH::SubShapeIDPair(
+					shape_pair.GetBody2ID(),
+					shape_pair.GetSubShapeID2(),
+					shape_pair.GetBody1ID(),
+					shape_pair.GetSubShapeID1()
+				));
+			} break;
+		}
+	}
+
+	ordered_overlap_events.clear();
 }
 
 void JoltContactListener3D::_flush_area_enters() {
+	const JoltTraceScope trace_scope("JoltContactListener3D::_flush_area_enters");
+
 	for (const JPH::SubShapeIDPair& shape_pair : area_enters) {
 		const JPH::BodyID& body_id1 = shape_pair.GetBody1ID();
 		const JPH::BodyID& body_id2 = shape_pair.GetBody2ID();
@@ -461,36 +832,90 @@ void JoltContactListener3D::_flush_area_enters() {
 	area_enters.clear();
 }
 
-void JoltContactListener3D::_flush_area_shifts() {
-	for (const JPH::SubShapeIDPair& shape_pair : area_overlaps) {
-		auto is_shifted = [&](const JPH::BodyID& p_body_id, const JPH::SubShapeID& p_sub_shape_id) {
-			const JoltReadableBody3D jolt_body = space->read_body(p_body_id, false);
-			const JoltObjectImpl3D* object = jolt_body.as_object();
-			ERR_FAIL_NULL_V(object, false);
+void JoltContactListener3D::_flush_area_shifts(
+	const JPH::BodyID* p_swapped_ids,
+	int32_t p_swapped_count
+) {
+	const JoltTraceScope trace_scope("JoltContactListener3D::_flush_area_shifts");
 
-			if (object->get_previous_jolt_shape() == nullptr) {
-				return false;
-			}
+	auto is_shifted = [&](const JPH::BodyID& p_body_id, const JPH::SubShapeID& p_sub_shape_id) {
+		const JoltReadableBody3D jolt_body = space->read_body(p_body_id, false);
+		const JoltObjectImpl3D* object = jolt_body.as_object();
+		ERR_FAIL_NULL_V(object, false);
 
-			const JPH::Shape& current_shape = *object->get_jolt_shape();
-			const JPH::Shape& previous_shape = *object->get_previous_jolt_shape();
+		if (object->get_previous_jolt_shape() == nullptr) {
+			return false;
+		}
 
-			const auto current_id = (uint32_t)current_shape.GetSubShapeUserData(p_sub_shape_id);
-			const auto previous_id = (uint32_t)previous_shape.GetSubShapeUserData(p_sub_shape_id);
+		const JPH::Shape& current_shape = *object->get_jolt_shape();
+		const JPH::Shape& previous_shape = *object->get_previous_jolt_shape();
 
-			return current_id != previous_id;
-		};
+		const auto current_id = (uint32_t)current_shape.GetSubShapeUserData(p_sub_shape_id);
+		const auto previous_id = (uint32_t)previous_shape.GetSubShapeUserData(p_sub_shape_id);
+
+		return current_id != previous_id;
+	};
+
+	// Only overlaps involving an object whose shape was swapped during this step can have shifted,
+	// so we only need to look at those.
+
+	for (int32_t i = 0; i < p_swapped_count; ++i) {
+		const LocalVector<JPH::SubShapeIDPair>* overlaps = area_overlaps_by_body.getptr(
+			p_swapped_ids[i]
+		);
 
-		if (is_shifted(shape_pair.GetBody1ID(), shape_pair.GetSubShapeID1()) ||
-			is_shifted(shape_pair.GetBody2ID(), shape_pair.GetSubShapeID2()))
-		{
-			area_enters.insert(shape_pair);
-			area_exits.insert(shape_pair);
+		if (overlaps == nullptr) {
+			continue;
+		}
+
+		for (const JPH::SubShapeIDPair& shape_pair : *overlaps) {
+			if (is_shifted(shape_pair.GetBody1ID(), shape_pair.GetSubShapeID1()) ||
+				is_shifted(shape_pair.GetBody2ID(), shape_pair.GetSubShapeID2()))
+			{
+				area_enters.insert(shape_pair);
+				area_exits.insert(shape_pair);
+			}
 		}
 	}
 }
 
+void JoltContactListener3D::_add_area_overlap(const JPH::SubShapeIDPair& p_shape_pair) {
+	area_overlaps.insert(p_shape_pair);
+
+	area_overlaps_by_body[p_shape_pair.GetBody1ID()].push_back(p_shape_pair);
+	area_overlaps_by_body[p_shape_pair.GetBody2ID()].push_back(p_shape_pair);
+}
+
+bool JoltContactListener3D::_remove_area_overlap(const JPH::SubShapeIDPair& p_shape_pair) {
+	if (!area_overlaps.erase(p_shape_pair)) {
+		return false;
+	}
+
+	auto remove_from_body = [&](const JPH::BodyID& p_body_id) {
+		LocalVector<JPH::SubShapeIDPair>* overlaps = area_overlaps_by_body.getptr(p_body_id);
+		ERR_FAIL_NULL(overlaps);
+
+		for (int32_t i = 0; i < overlaps->size(); ++i) {
+			if ((*overlaps)[i] == p_shape_pair) {
+				overlaps->remove_at_unordered(i);
+				break;
+			}
+		}
+
+		if (overlaps->is_empty()) {
+			area_overlaps_by_body.erase(p_body_id);
+		}
+	};
+
+	remove_from_body(p_shape_pair.GetBody1ID());
+	remove_from_body(p_shape_pair.GetBody2ID());
+
+	return true;
+}
+
 void JoltContactListener3D::_flush_area_exits() {
+	const JoltTraceScope trace_scope("JoltContactListener3D::_flush_area_exits");
+
 	for (const JPH::SubShapeIDPair& shape_pair : area_exits) {
 		const JPH::BodyID& body_id1 = shape_pair.GetBody1ID();
 		const JPH::BodyID& body_id2 = shape_pair.GetBody2ID();
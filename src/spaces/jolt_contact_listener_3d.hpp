@@ -1,6 +1,6 @@
 #pragma once
 
-class JoltObjectImpl3D;
+class JoltBodyImpl3D;
 class JoltSpace3D;
 
 class JoltContactListener3D final : public JPH::ContactListener {
@@ -38,31 +38,121 @@ class JoltContactListener3D final : public JPH::ContactListener {
 		JPH::Vec3 impulse = {};
 	};
 
-	using Contacts = LocalVector<Contact>;
-
 	struct Manifold {
-		Contacts contacts1;
+		JPH::SubShapeIDPair shape_pair;
 
-		Contacts contacts2;
+		uint64_t sequence = 0;
 
 		float depth = 0.0f;
+
+		int32_t contact_offset = 0;
+
+		int32_t contact_count = 0;
+	};
+
+	enum OverlapEventType : int8_t {
+		OVERLAP_EVENT_OVERLAPPING,
+		OVERLAP_EVENT_SEPARATED,
+		OVERLAP_EVENT_REMOVED
+	};
+
+	// Since a single step can consist of multiple collision steps, the same shape pair can show up
+	// in several of these (and in several manifolds), possibly in different thread buffers, so they
+	// carry a sequence number to let them be applied in the order they were reported.
+	struct OverlapEvent {
+		JPH::SubShapeIDPair shape_pair;
+
+		uint64_t sequence = 0;
+
+		OverlapEventType type = OVERLAP_EVENT_OVERLAPPING;
+	};
+
+	// Everything reported from within the step ends up in one of these, with each thread writing to
+	// its own buffer, which then gets processed in `post_step`.
+	struct ThreadBuffer {
+		LocalVector<Manifold> manifolds;
+
+		LocalVector<Contact> contacts1;
+
+		LocalVector<Contact> contacts2;
+
+		LocalVector<OverlapEvent> overlap_events;
+	};
+
+	struct LatestManifold {
+		const Manifold* manifold = nullptr;
+
+		const ThreadBuffer* buffer = nullptr;
+
+		bool removed = false;
 	};
 
-	using BodyIDs = HashSet<JPH::BodyID, BodyIDHasher>;
+	struct StreamManifold {
+		JoltBodyImpl3D* body1 = nullptr;
+
+		JoltBodyImpl3D* body2 = nullptr;
+
+		const Contact* contacts1 = nullptr;
+
+		const Contact* contacts2 = nullptr;
+
+		int32_t shape_index1 = 0;
+
+		int32_t shape_index2 = 0;
+
+		int32_t contact_count = 0;
+	};
 
 	using Overlaps = HashSet<JPH::SubShapeIDPair, ShapePairHasher>;
 
-	using ManifoldsByShapePair = HashMap<JPH::SubShapeIDPair, Manifold, ShapePairHasher>;
+	using OverlapsByBody = HashMap<JPH::BodyID, LocalVector<JPH::SubShapeIDPair>, BodyIDHasher>;
+
+	using ManifoldsByShapePair = HashMap<JPH::SubShapeIDPair, LatestManifold, ShapePairHasher>;
 
 public:
-	explicit JoltContactListener3D(JoltSpace3D* p_space)
-		: space(p_space) { }
+	// All contacts reported during the last step, laid out as parallel arrays and grouped by body,
+	// with `bodies`, `body_offsets` and `body_counts` describing the range belonging to each body.
+	struct ContactStream {
+		PackedInt64Array bodies;
+
+		PackedInt32Array body_offsets;
+
+		PackedInt32Array body_counts;
+
+		PackedInt64Array colliders;
+
+		PackedInt32Array shapes;
+
+		PackedInt32Array collider_shapes;
+
+		PackedVector3Array points;
 
-	void listen_for(JoltObjectImpl3D* p_object);
+		PackedVector3Array normals;
+
+		PackedVector3Array impulses;
+	};
+
+	explicit JoltContactListener3D(JoltSpace3D* p_space);
+
+	JoltContactListener3D(const JoltContactListener3D& p_other) = delete;
+
+	JoltContactListener3D(JoltContactListener3D&& p_other) = delete;
+
+	~JoltContactListener3D() override;
+
+	void listen_for(const JPH::BodyID& p_body_id);
+
+	void stop_listening_for(const JPH::BodyID& p_body_id);
 
 	void pre_step();
 
-	void post_step();
+	void post_step(const JPH::BodyID* p_swapped_ids, int32_t p_swapped_count);
+
+	bool is_contact_stream_enabled() const { return contact_stream_enabled; }
+
+	void set_contact_stream_enabled(bool p_enabled);
+
+	const ContactStream& get_contact_stream() const { return contact_stream; }
 
 #ifdef GDJ_CONFIG_EDITOR
 	const PackedVector3Array& get_debug_contacts() const { return debug_contacts; }
@@ -74,6 +164,10 @@ public:
 	void set_max_debug_contacts(int32_t p_count) { debug_contacts.resize(p_count); }
 #endif // GDJ_CONFIG_EDITOR
 
+	JoltContactListener3D& operator=(const JoltContactListener3D& p_other) = delete;
+
+	JoltContactListener3D& operator=(JoltContactListener3D&& p_other) = delete;
+
 private:
 	void OnContactAdded(
 		const JPH::Body& p_body1,
@@ -118,9 +212,13 @@ private:
 		const JPH::ContactManifold& p_manifold
 	);
 
-	bool _try_remove_contacts(const JPH::SubShapeIDPair& p_shape_pair);
+	template<typename TCallback>
+	void _write_to_thread_buffer(TCallback&& p_callback);
+
+	void _write_overlap_event(const JPH::SubShapeIDPair& p_shape_pair, OverlapEventType p_type);
 
-	bool _try_remove_area_overlap(const JPH::SubShapeIDPair& p_shape_pair);
+	template<typename TCallback>
+	void _for_each_thread_buffer(TCallback&& p_callback);
 
 #ifdef GDJ_CONFIG_EDITOR
 	bool _try_add_debug_contacts(
@@ -130,28 +228,66 @@ private:
 	);
 #endif // GDJ_CONFIG_EDITOR
 
+	void _gather_manifolds();
+
 	void _flush_contacts();
 
+	void _flush_contact_stream();
+
+	void _flush_area_overlaps();
+
 	void _flush_area_enters();
 
-	void _flush_area_shifts();
+	void _flush_area_shifts(const JPH::BodyID* p_swapped_ids, int32_t p_swapped_count);
+
+	void _add_area_overlap(const JPH::SubShapeIDPair& p_shape_pair);
+
+	bool _remove_area_overlap(const JPH::SubShapeIDPair& p_shape_pair);
 
 	void _flush_area_exits();
 
-	ManifoldsByShapePair manifolds_by_shape_pair;
+	inline static thread_local int32_t thread_slot = -1;
+
+	inline static std::atomic<int32_t> thread_slot_count = 0;
+
+	LocalVector<ThreadBuffer*> thread_buffers;
+
+	ThreadBuffer shared_buffer;
+
+	ManifoldsByShapePair latest_manifolds;
+
+	LocalVector<LatestManifold> ordered_manifolds;
 
-	BodyIDs listening_for;
+	ContactStream contact_stream;
+
+	LocalVector<StreamManifold> stream_manifolds;
+
+	LocalVector<int32_t> stream_cursors;
+
+	HashMap<JoltBodyImpl3D*, int32_t> stream_ranges_by_body;
+
+	// One bit per body index, sized for the maximum number of bodies, so that it can be tested from
+	// the contact callbacks without any bounds checks or hashing.
+	LocalVector<uint64_t> listening_for;
 
 	Overlaps area_overlaps;
 
+	OverlapsByBody area_overlaps_by_body;
+
 	Overlaps area_enters;
 
 	Overlaps area_exits;
 
-	Mutex write_mutex;
+	LocalVector<OverlapEvent> ordered_overlap_events;
+
+	std::atomic<uint64_t> next_event_sequence = 0;
+
+	Mutex shared_buffer_mutex;
 
 	JoltSpace3D* space = nullptr;
 
+	bool contact_stream_enabled = false;
+
 #ifdef GDJ_CONFIG_EDITOR
 	PackedVector3Array debug_contacts;
 
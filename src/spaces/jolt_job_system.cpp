@@ -1,10 +1,44 @@
 #include "jolt_job_system.hpp"
 
+#include "servers/jolt_physics_server_3d.hpp"
 #include "servers/jolt_project_settings.hpp"
+#include "servers/jolt_tracer.hpp"
+#include "spaces/jolt_thread_pool.hpp"
+
+namespace {
+
+// Any thread past this number will share a single set of groups that's guarded by a mutex instead
+constexpr int32_t MAX_THREAD_GROUPS = 128;
+
+constexpr int32_t MAX_JOBS = JPH::cMaxPhysicsJobs * JoltJobSystem::MAX_CONCURRENT_STEPS;
+
+} // namespace
 
 JoltJobSystem::JoltJobSystem()
-	: JPH::JobSystemWithBarrier(JPH::cMaxPhysicsBarriers)
-	, jobs(JPH::cMaxPhysicsJobs) {
+	: JPH::JobSystemWithBarrier(JPH::cMaxPhysicsBarriers * MAX_CONCURRENT_STEPS)
+	, jobs(MAX_JOBS) {
+	thread_groups.resize(MAX_THREAD_GROUPS);
+
+	for (ThreadGroups*& groups : thread_groups) {
+		groups = nullptr;
+	}
+
+	if (JoltProjectSettings::use_dedicated_threads()) {
+		int32_t worker_count = JoltProjectSettings::get_dedicated_thread_count();
+
+		if (worker_count == 0) {
+			// The thread that's waiting on the jobs will also be executing some of them, so we
+			// leave room for that one
+			worker_count = max(OS::get_singleton()->get_processor_count() - 1, 1);
+		}
+
+		// Every job could end up being queued at once, so each worker's queue needs to fit them all
+		thread_pool = new JoltThreadPool(worker_count, MAX_JOBS);
+		thread_count = worker_count + 1;
+
+		return;
+	}
+
 	const int32_t max_threads = JoltProjectSettings::get_max_threads();
 
 	if (max_threads != -1) {
@@ -14,13 +48,61 @@ JoltJobSystem::JoltJobSystem()
 	}
 }
 
+JoltJobSystem::~JoltJobSystem() {
+	delete_safely(thread_pool);
+
+	const auto delete_groups = [](ThreadGroups& p_groups) {
+		for (JobGroup* group : p_groups.free) {
+			delete group;
+		}
+	};
+
+	for (ThreadGroups* groups : thread_groups) {
+		if (groups != nullptr) {
+			delete_groups(*groups);
+			delete groups;
+		}
+	}
+
+	delete_groups(shared_groups);
+}
+
 void JoltJobSystem::pre_step() {
 	// Nothing to do
 }
 
 void JoltJobSystem::post_step() {
-	while (Job* job = Job::pop_completed()) {
-		jobs.destruct(job);
+	// Every job will have been executed by now, but since the barrier will sometimes execute jobs
+	// itself, the tasks that were queued for those jobs might not have run yet. `WorkerThreadPool`
+	// also needs us to wait on the group tasks in order for it to clean up after them. Nothing is
+	// queuing jobs at this point, so we're free to touch the groups of every thread.
+	WorkerThreadPool* thread_pool_godot = WorkerThreadPool::get_singleton();
+
+	const auto reclaim_groups = [&](ThreadGroups& p_groups) {
+		for (JobGroup* group : p_groups.queued) {
+			thread_pool_godot->wait_for_group_task_completion(group->task_id);
+
+			group->jobs.clear();
+			group->task_id = -1;
+
+			p_groups.free.push_back(group);
+		}
+
+		p_groups.queued.clear();
+	};
+
+	for (ThreadGroups* groups : thread_groups) {
+		if (groups != nullptr) {
+			reclaim_groups(*groups);
+		}
+	}
+
+	reclaim_groups(shared_groups);
+
+	// The dedicated threads have nothing to wait on, so we instead wait for the remaining tasks to
+	// release their jobs, which shouldn't take long, given that the jobs themselves are all done.
+	while (queued_job_count.load(std::memory_order_acquire) != 0) {
+		std::this_thread::yield();
 	}
 }
 
@@ -59,54 +141,17 @@ JoltJobSystem::Job::Job(
 	JPH::uint32 p_dependency_count
 )
 	: JPH::JobSystem::Job(p_name, p_color, p_job_system, p_job_function, p_dependency_count)
-#ifdef GDJ_CONFIG_EDITOR
 	, name(p_name)
-#endif // GDJ_CONFIG_EDITOR
-{
-}
-
-JoltJobSystem::Job::~Job() {
-	if (task_id != -1) {
-		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
-	}
-}
-
-void JoltJobSystem::Job::push_completed(Job* p_job) {
-	Job* prev_head = nullptr;
-
-	do {
-		prev_head = completed_head;
-		p_job->completed_next = prev_head;
-	} while (!completed_head.compare_exchange_weak(prev_head, p_job));
-}
-
-JoltJobSystem::Job* JoltJobSystem::Job::pop_completed() {
-	Job* prev_head = nullptr;
-
-	do {
-		prev_head = completed_head;
-
-		if (prev_head == nullptr) {
-			return nullptr;
-		}
-	} while (!completed_head.compare_exchange_weak(prev_head, prev_head->completed_next));
-
-	return prev_head;
-}
+	, job_system(static_cast<JoltJobSystem*>(p_job_system)) { }
 
-void JoltJobSystem::Job::queue() {
-	AddRef();
-
-	// HACK(mihe): Ideally we would use Jolt's actual job name here, but I'd rather not incur the
-	// overhead of a memory allocation or thread-safe lookup every time we create/queue a task. So
-	// instead we use the same cached description for all of them.
-	static const String task_name("JoltPhysics");
+void JoltJobSystem::Job::execute(void* p_user_data) {
+	auto* job = static_cast<Job*>(p_user_data);
 
-	task_id = WorkerThreadPool::get_singleton()->add_native_task(&_execute, this, true, task_name);
-}
+	const JoltTraceScope trace_scope(job->name);
 
-void JoltJobSystem::Job::_execute(void* p_user_data) {
-	auto* job = static_cast<Job*>(p_user_data);
+	// Jobs can end up running on the thread that's waiting on them, which is already marked
+	const bool was_stepping_thread = JoltPhysicsServer3D::is_stepping_thread();
+	JoltPhysicsServer3D::set_stepping_thread(true);
 
 #ifdef GDJ_CONFIG_EDITOR
 	const uint64_t time_start = Time::get_singleton()->get_ticks_usec();
@@ -123,9 +168,19 @@ void JoltJobSystem::Job::_execute(void* p_user_data) {
 	timings_lock.unlock();
 #endif // GDJ_CONFIG_EDITOR
 
+	JoltPhysicsServer3D::set_stepping_thread(was_stepping_thread);
+
+	// Releasing the job can free it, so we need to be done with it before then
+	job->job_system->queued_job_count.fetch_sub(1, std::memory_order_release);
+
 	job->Release();
 }
 
+void JoltJobSystem::_execute_group(void* p_user_data, uint32_t p_index) {
+	auto* group = static_cast<JobGroup*>(p_user_data);
+	Job::execute(group->jobs[p_index]);
+}
+
 int JoltJobSystem::GetMaxConcurrency() const {
 	return thread_count;
 }
@@ -164,15 +219,81 @@ JPH::JobHandle JoltJobSystem::CreateJob(
 }
 
 void JoltJobSystem::QueueJob(JPH::JobSystem::Job* p_job) {
-	static_cast<Job*>(p_job)->queue();
+	QueueJobs(&p_job, 1);
 }
 
 void JoltJobSystem::QueueJobs(JPH::JobSystem::Job** p_jobs, JPH::uint p_job_count) {
 	for (JPH::uint i = 0; i < p_job_count; ++i) {
-		QueueJob(p_jobs[i]);
+		p_jobs[i]->AddRef();
+	}
+
+	queued_job_count.fetch_add((int32_t)p_job_count, std::memory_order_relaxed);
+
+	if (thread_pool != nullptr) {
+		for (JPH::uint i = 0; i < p_job_count; ++i) {
+			thread_pool->submit(&Job::execute, p_jobs[i]);
+		}
+
+		return;
+	}
+
+	// HACK(mihe): Ideally we would use Jolt's actual job name here, but I'd rather not incur the
+	// overhead of a memory allocation or thread-safe lookup every time we create/queue a task. So
+	// instead we use the same cached description for all of them.
+	static const String task_name("JoltPhysics");
+
+	_with_thread_groups([&](ThreadGroups& p_groups) {
+		JobGroup* group = nullptr;
+
+		if (!p_groups.free.is_empty()) {
+			const int32_t last_index = p_groups.free.size() - 1;
+			group = p_groups.free[last_index];
+			p_groups.free.remove_at_unordered(last_index);
+		} else {
+			group = new JobGroup();
+		}
+
+		group->jobs.resize(p_job_count);
+
+		for (JPH::uint i = 0; i < p_job_count; ++i) {
+			group->jobs[i] = static_cast<Job*>(p_jobs[i]);
+		}
+
+		group->task_id = WorkerThreadPool::get_singleton()->add_native_group_task(
+			&_execute_group,
+			group,
+			(int32_t)p_job_count,
+			-1,
+			true,
+			task_name
+		);
+
+		p_groups.queued.push_back(group);
+	});
+}
+
+template<typename TCallback>
+void JoltJobSystem::_with_thread_groups(TCallback&& p_callback) {
+	if (thread_slot == -1) {
+		thread_slot = thread_slot_count++;
+	}
+
+	if (thread_slot < MAX_THREAD_GROUPS) {
+		ThreadGroups*& groups = thread_groups[thread_slot];
+
+		if (groups == nullptr) {
+			groups = new ThreadGroups();
+		}
+
+		p_callback(*groups);
+	} else {
+		const std::lock_guard shared_groups_lock(shared_groups_mutex);
+		p_callback(shared_groups);
 	}
 }
 
 void JoltJobSystem::FreeJob(JPH::JobSystem::Job* p_job) {
-	Job::push_completed(static_cast<Job*>(p_job));
+	// Since nothing ends up waiting on individual jobs anymore, we can return them to the free list
+	// right away, rather than holding on to them until the end of the step
+	jobs.destruct(static_cast<Job*>(p_job));
 }
@@ -1,9 +1,21 @@
 #pragma once
 
+class JoltThreadPool;
+
 class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 public:
+	// The barriers and jobs are sized for this many spaces being stepped at the same time, which
+	// means that anything stepping spaces in parallel must not exceed this.
+	static constexpr int32_t MAX_CONCURRENT_STEPS = 4;
+
 	JoltJobSystem();
 
+	JoltJobSystem(const JoltJobSystem& p_other) = delete;
+
+	JoltJobSystem(JoltJobSystem&& p_other) = delete;
+
+	~JoltJobSystem() override;
+
 	void pre_step();
 
 	void post_step();
@@ -12,6 +24,10 @@ public:
 	void flush_timings();
 #endif // GDJ_CONFIG_EDITOR
 
+	JoltJobSystem& operator=(const JoltJobSystem& p_other) = delete;
+
+	JoltJobSystem& operator=(JoltJobSystem&& p_other) = delete;
+
 private:
 	class Job : public JPH::JobSystem::Job {
 	public:
@@ -25,32 +41,38 @@ private:
 
 		Job(Job&& p_other) = delete;
 
-		~Job();
-
-		static void push_completed(Job* p_job);
-
-		static Job* pop_completed();
-
-		void queue();
+		static void execute(void* p_user_data);
 
 		Job& operator=(const Job& p_other) = delete;
 
 		Job& operator=(Job&& p_other) = delete;
 
 	private:
-		static void _execute(void* p_user_data);
+		const char* name = nullptr;
 
-		inline static std::atomic<Job*> completed_head = nullptr;
+		JoltJobSystem* job_system = nullptr;
+	};
 
-#ifdef GDJ_CONFIG_EDITOR
-		const char* name = nullptr;
-#endif // GDJ_CONFIG_EDITOR
+	struct JobGroup {
+		LocalVector<Job*> jobs;
 
 		int64_t task_id = -1;
+	};
+
+	// Each thread that queues jobs keeps track of its own groups, so that queuing jobs from the
+	// worker threads (which happens every time a job's dependencies are released) never has to
+	// contend for a lock.
+	struct ThreadGroups {
+		LocalVector<JobGroup*> queued;
 
-		std::atomic<Job*> completed_next = nullptr;
+		LocalVector<JobGroup*> free;
 	};
 
+	static void _execute_group(void* p_user_data, uint32_t p_index);
+
+	template<typename TCallback>
+	void _with_thread_groups(TCallback&& p_callback);
+
 	int GetMaxConcurrency() const override;
 
 	JPH::JobHandle CreateJob(
@@ -76,5 +98,19 @@ private:
 
 	FreeList<Job> jobs;
 
+	inline static thread_local int32_t thread_slot = -1;
+
+	inline static std::atomic<int32_t> thread_slot_count = 0;
+
+	LocalVector<ThreadGroups*> thread_groups;
+
+	ThreadGroups shared_groups;
+
+	std::mutex shared_groups_mutex;
+
+	std::atomic<int32_t> queued_job_count = 0;
+
+	JoltThreadPool* thread_pool = nullptr;
+
 	int32_t thread_count = 0;
 };
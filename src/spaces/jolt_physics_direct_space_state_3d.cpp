@@ -26,6 +26,8 @@ bool JoltPhysicsDirectSpaceState3D::_intersect_ray(
 	bool p_pick_ray,
 	PhysicsServer3DExtensionRayResult* p_result
 ) {
+	_wait_for_step();
+
 	const JoltQueryFilter3D query_filter(
 		*this,
 		p_collision_mask,
@@ -99,6 +101,8 @@ int32_t JoltPhysicsDirectSpaceState3D::_intersect_point(
 	PhysicsServer3DExtensionShapeResult* p_results,
 	int32_t p_max_results
 ) {
+	_wait_for_step();
+
 	if (p_max_results == 0) {
 		return 0;
 	}
@@ -145,6 +149,8 @@ int32_t JoltPhysicsDirectSpaceState3D::_intersect_shape(
 	PhysicsServer3DExtensionShapeResult* p_results,
 	int32_t p_max_results
 ) {
+	_wait_for_step();
+
 	if (p_max_results == 0) {
 		return 0;
 	}
@@ -217,6 +223,8 @@ bool JoltPhysicsDirectSpaceState3D::_cast_motion(
 	float* p_closest_unsafe,
 	PhysicsServer3DExtensionShapeRestInfo* p_info
 ) {
+	_wait_for_step();
+
 	// HACK(mihe): This rest info parameter doesn't seem to be used anywhere within Godot, and isn't
 	// exposed in the bindings, so this will be unsupported until anyone actually needs it.
 	ERR_FAIL_COND_D_MSG(
@@ -273,6 +281,8 @@ bool JoltPhysicsDirectSpaceState3D::_collide_shape(
 	int32_t p_max_results,
 	int32_t* p_result_count
 ) {
+	_wait_for_step();
+
 	*p_result_count = 0;
 
 	if (p_max_results == 0) {
@@ -345,6 +355,8 @@ bool JoltPhysicsDirectSpaceState3D::_rest_info(
 	bool p_collide_with_areas,
 	PhysicsServer3DExtensionShapeRestInfo* p_info
 ) {
+	_wait_for_step();
+
 	auto* physics_server = static_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton());
 
 	JoltShapeImpl3D* shape = physics_server->get_shape(p_shape_rid);
@@ -409,6 +421,8 @@ Vector3 JoltPhysicsDirectSpaceState3D::_get_closest_point_to_object_volume(
 	const RID& p_object,
 	const Vector3& p_point
 ) const {
+	_wait_for_step();
+
 	auto* physics_server = static_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton());
 
 	JoltObjectImpl3D* object = physics_server->get_area(p_object);
@@ -969,3 +983,9 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_collide(
 
 	return count > 0;
 }
+
+void JoltPhysicsDirectSpaceState3D::_wait_for_step() const {
+	// Queries can be made from anywhere at any time, so we need to make sure that the physics step
+	// isn't still running in the background before reading from the space.
+	static_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton())->wait_for_step();
+}
@@ -143,5 +143,7 @@ private:
 		PhysicsServer3DExtensionMotionResult* p_result
 	) const;
 
+	void _wait_for_step() const;
+
 	JoltSpace3D* space = nullptr;
 };
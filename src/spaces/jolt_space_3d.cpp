@@ -4,6 +4,7 @@
 #include "objects/jolt_area_impl_3d.hpp"
 #include "objects/jolt_body_impl_3d.hpp"
 #include "servers/jolt_project_settings.hpp"
+#include "servers/jolt_tracer.hpp"
 #include "shapes/jolt_custom_shape_type.hpp"
 #include "shapes/jolt_shape_impl_3d.hpp"
 #include "spaces/jolt_contact_listener_3d.hpp"
@@ -21,6 +22,16 @@ constexpr double DEFAULT_SLEEP_THRESHOLD_LINEAR = 0.1;
 constexpr double DEFAULT_SLEEP_THRESHOLD_ANGULAR = 8.0 * Math_PI / 180;
 constexpr double DEFAULT_SOLVER_ITERATIONS = 8;
 
+constexpr int32_t STEP_BATCH_SIZE = 128;
+
+constexpr int32_t BROAD_PHASE_OPTIMIZATION_THRESHOLD = 1024;
+
+void atomic_max(std::atomic<float>& p_value, float p_candidate) {
+	float current = p_value;
+
+	while (current < p_candidate && !p_value.compare_exchange_weak(current, p_candidate)) { }
+}
+
 } // namespace
 
 JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
@@ -29,7 +40,8 @@ JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
 	, temp_allocator(new JoltTempAllocator())
 	, layer_mapper(new JoltLayerMapper())
 	, contact_listener(new JoltContactListener3D(this))
-	, physics_system(new JPH::PhysicsSystem()) {
+	, physics_system(new JPH::PhysicsSystem())
+	, collision_steps(JoltProjectSettings::get_collision_steps()) {
 	physics_system->Init(
 		(JPH::uint)JoltProjectSettings::get_max_bodies(),
 		0,
@@ -74,18 +86,6 @@ JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
 			return clamp(p_body1.GetRestitution() + p_body2.GetRestitution(), 0.0f, 1.0f);
 		}
 	);
-
-#ifdef GDJ_CONFIG_EDITOR
-	// HACK(mihe): The `EditorLog` class gets initialized fairly late in the application flow, so if
-	// we do this any earlier the warning is only ever going to be emitted to stdout and not the
-	// editor log, hence why this is here.
-	if (JoltProjectSettings::should_run_on_separate_thread()) {
-		WARN_PRINT_ONCE(
-			"Running on a separate thread is not currently supported by Godot Jolt. "
-			"Any such setting will be ignored."
-		);
-	}
-#endif // GDJ_CONFIG_EDITOR
 }
 
 JoltSpace3D::~JoltSpace3D() {
@@ -99,10 +99,22 @@ JoltSpace3D::~JoltSpace3D() {
 void JoltSpace3D::step(float p_step) {
 	last_step = p_step;
 
+	flush_adds();
+
 	_pre_step(p_step);
 
-	const JPH::EPhysicsUpdateError
-		update_error = physics_system->Update(p_step, 1, temp_allocator, job_system);
+	if (interpolation_enabled) {
+		_store_previous_transforms();
+	}
+
+	const JPH::EPhysicsUpdateError update_error = physics_system->Update(
+		p_step,
+		_calculate_collision_steps(p_step),
+		temp_allocator,
+		job_system
+	);
+
+	temp_allocator->post_step();
 
 	if ((update_error & JPH::EPhysicsUpdateError::ManifoldCacheFull) !=
 		JPH::EPhysicsUpdateError::None)
@@ -139,10 +151,16 @@ void JoltSpace3D::step(float p_step) {
 
 	_post_step(p_step);
 
+	if (interpolation_enabled) {
+		_store_current_transforms();
+	}
+
 	has_stepped = true;
 }
 
 void JoltSpace3D::call_queries() {
+	const JoltTraceScope trace_scope("JoltSpace3D::call_queries");
+
 	if (!has_stepped) {
 		// HACK(mihe): We need to skip the first invocation of this method, because there will be
 		// pending notifications that need to be flushed first, which can cause weird conflicts with
@@ -152,23 +170,36 @@ void JoltSpace3D::call_queries() {
 		return;
 	}
 
-	body_accessor.acquire_all();
+	// We only visit the objects that have actually queued themselves up for this, and we do so
+	// through their IDs, since the callbacks are free to remove objects from the space or even free
+	// them altogether, in which case the lookup will simply fail.
+	query_ids.clear();
 
-	const int32_t body_count = body_accessor.get_count();
+	for (JoltBodyImpl3D* body : bodies_to_query) {
+		body->query_queued = false;
+		query_ids.push_back(body->get_jolt_id());
+	}
 
-	for (int32_t i = 0; i < body_count; ++i) {
+	for (JoltAreaImpl3D* area : areas_to_query) {
+		area->query_queued = false;
+		query_ids.push_back(area->get_jolt_id());
+	}
+
+	const int32_t body_count = bodies_to_query.size();
+	const auto query_count = (int32_t)query_ids.size();
+
+	bodies_to_query.clear();
+	areas_to_query.clear();
+
+	body_accessor.acquire(query_ids.data(), query_count);
+
+	for (int32_t i = 0; i < query_count; ++i) {
 		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (!jolt_body->IsSensor()) {
+			if (i < body_count) {
 				auto* body = reinterpret_cast<JoltBodyImpl3D*>(jolt_body->GetUserData());
 
 				body->call_queries(*jolt_body);
-			}
-		}
-	}
-
-	for (int32_t i = 0; i < body_count; ++i) {
-		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (jolt_body->IsSensor()) {
+			} else {
 				auto* area = reinterpret_cast<JoltAreaImpl3D*>(jolt_body->GetUserData());
 
 				area->call_queries(*jolt_body);
@@ -370,6 +401,9 @@ JoltWritableBodies3D JoltSpace3D::write_bodies(
 }
 
 JoltPhysicsDirectSpaceState3D* JoltSpace3D::get_direct_state() {
+	// Any bodies created since the last step need to be in the broad phase for queries to find them
+	flush_adds();
+
 	if (direct_state == nullptr) {
 		direct_state = memnew(JoltPhysicsDirectSpaceState3D(this));
 	}
@@ -377,6 +411,148 @@ JoltPhysicsDirectSpaceState3D* JoltSpace3D::get_direct_state() {
 	return direct_state;
 }
 
+int32_t JoltSpace3D::get_active_body_states(
+	PackedInt64Array& p_rids,
+	PackedFloat32Array& p_states
+) {
+	body_accessor.acquire_active();
+
+	const int32_t active_count = body_accessor.get_count();
+
+	// We size the buffers for the worst case, which means they can be reused from one step to the
+	// next without reallocating, as long as the caller holds on to them.
+	if (p_rids.size() < active_count) {
+		p_rids.resize(active_count);
+	}
+
+	if (p_states.size() < (int64_t)active_count * PACKED_BODY_STATE_SIZE) {
+		p_states.resize((int64_t)active_count * PACKED_BODY_STATE_SIZE);
+	}
+
+	int64_t* rids = p_rids.ptrw();
+	float* states = p_states.ptrw();
+
+	int32_t body_count = 0;
+
+	for (int32_t i = 0; i < active_count; ++i) {
+		const JPH::Body* jolt_body = body_accessor.try_get(i);
+
+		if (jolt_body == nullptr || jolt_body->IsSensor()) {
+			continue;
+		}
+
+		const auto* body = reinterpret_cast<const JoltBodyImpl3D*>(jolt_body->GetUserData());
+
+		const Transform3D transform(
+			to_godot(jolt_body->GetRotation()),
+			to_godot(jolt_body->GetPosition())
+		);
+
+		float* state = states + (ptrdiff_t)body_count * PACKED_BODY_STATE_SIZE;
+
+		pack_transform(transform.scaled_local(body->get_scale()), state);
+
+		const JPH::Vec3 linear_velocity = jolt_body->GetLinearVelocity();
+		const JPH::Vec3 angular_velocity = jolt_body->GetAngularVelocity();
+
+		state[PACKED_TRANSFORM_SIZE + 0] = linear_velocity.GetX();
+		state[PACKED_TRANSFORM_SIZE + 1] = linear_velocity.GetY();
+		state[PACKED_TRANSFORM_SIZE + 2] = linear_velocity.GetZ();
+		state[PACKED_TRANSFORM_SIZE + 3] = angular_velocity.GetX();
+		state[PACKED_TRANSFORM_SIZE + 4] = angular_velocity.GetY();
+		state[PACKED_TRANSFORM_SIZE + 5] = angular_velocity.GetZ();
+
+		rids[body_count++] = body->get_rid().get_id();
+	}
+
+	body_accessor.release();
+
+	return body_count;
+}
+
+void JoltSpace3D::set_interpolation_enabled(bool p_enabled) {
+	interpolation_enabled = p_enabled;
+
+	if (!interpolation_enabled) {
+		interpolated_ids.clear();
+		previous_positions.clear();
+		current_positions.clear();
+		previous_rotations.clear();
+		current_rotations.clear();
+		interpolated_scales.clear();
+		interpolated_rids.clear();
+	}
+}
+
+int32_t JoltSpace3D::interpolate_into(
+	float p_alpha,
+	PackedInt64Array& p_rids,
+	PackedFloat32Array& p_transforms
+) const {
+	const int32_t body_count = interpolated_rids.size();
+
+	if (p_rids.size() < body_count) {
+		p_rids.resize(body_count);
+	}
+
+	if (p_transforms.size() < (int64_t)body_count * PACKED_TRANSFORM_SIZE) {
+		p_transforms.resize((int64_t)body_count * PACKED_TRANSFORM_SIZE);
+	}
+
+	int64_t* rids = p_rids.ptrw();
+	float* transforms = p_transforms.ptrw();
+
+	for (int32_t i = 0; i < body_count; ++i) {
+		const auto index = (size_t)i;
+
+		const JPH::Vec3 previous_position = previous_positions[index];
+		const JPH::Vec3 position = previous_position +
+			(current_positions[index] - previous_position) * p_alpha;
+
+		const JPH::Quat rotation = previous_rotations[index].SLERP(
+			current_rotations[index],
+			p_alpha
+		);
+
+		const JPH::Mat44 matrix = JPH::Mat44::sRotationTranslation(rotation, position);
+		const JPH::Mat44 matrix_scaled = matrix.PreScaled(interpolated_scales[index]);
+
+		float* transform = transforms + (ptrdiff_t)i * PACKED_TRANSFORM_SIZE;
+
+		for (JPH::uint row = 0; row < 3; ++row) {
+			for (JPH::uint column = 0; column < 4; ++column) {
+				*transform++ = matrix_scaled(row, column);
+			}
+		}
+
+		rids[i] = interpolated_rids[i];
+	}
+
+	return body_count;
+}
+
+void JoltSpace3D::set_batch_integrator(
+	JoltBatchIntegrator p_integrator,
+	void* p_userdata,
+	bool p_parallel
+) {
+	batch_integrator = p_integrator;
+	batch_integrator_userdata = p_userdata;
+	batch_integrator_parallel = p_parallel;
+}
+
+bool JoltSpace3D::is_contact_stream_enabled() const {
+	return contact_listener->is_contact_stream_enabled();
+}
+
+void JoltSpace3D::set_contact_stream_enabled(bool p_enabled) {
+	contact_listener->set_contact_stream_enabled(p_enabled);
+}
+
+const JoltContactListener3D::ContactStream& JoltSpace3D::get_contact_stream() const {
+	return contact_listener->get_contact_stream();
+}
+
 void JoltSpace3D::add_joint(JPH::Constraint* p_jolt_ref) {
 	physics_system->AddConstraint(p_jolt_ref);
 }
@@ -393,6 +569,123 @@ void JoltSpace3D::remove_joint(JoltJointImpl3D* p_joint) {
 	remove_joint(p_joint->get_jolt_ref());
 }
 
+void JoltSpace3D::add_area(JoltAreaImpl3D* p_area) {
+	areas.push_back(p_area);
+}
+
+void JoltSpace3D::remove_area(JoltAreaImpl3D* p_area) {
+	areas.erase(p_area);
+}
+
+void JoltSpace3D::add_stepping_object(JoltObjectImpl3D* p_object) {
+	stepping_objects.push_back(p_object);
+}
+
+void JoltSpace3D::remove_stepping_object(JoltObjectImpl3D* p_object) {
+	stepping_objects.erase(p_object);
+}
+
+void JoltSpace3D::listen_for_contacts(const JoltObjectImpl3D* p_object) {
+	contact_listener->listen_for(p_object->get_jolt_id());
+}
+
+void JoltSpace3D::stop_listening_for_contacts(const JoltObjectImpl3D* p_object) {
+	contact_listener->stop_listening_for(p_object->get_jolt_id());
+}
+
+void JoltSpace3D::enqueue_shape_swap(JoltObjectImpl3D* p_object) {
+	shape_swapped_objects.push_back(p_object);
+}
+
+void JoltSpace3D::dequeue_shape_swap(JoltObjectImpl3D* p_object) {
+	shape_swapped_objects.erase(p_object);
+}
+
+void JoltSpace3D::enqueue_add(JoltObjectImpl3D* p_object) {
+	p_object->add_index = objects_to_add.size();
+	objects_to_add.push_back(p_object);
+}
+
+void JoltSpace3D::dequeue_add(JoltObjectImpl3D* p_object) {
+	const int32_t index = p_object->add_index;
+	ERR_FAIL_INDEX(index, objects_to_add.size());
+
+	// The order in which the objects get added doesn't matter, so we can just swap in the last one
+	const int32_t last_index = objects_to_add.size() - 1;
+	objects_to_add[last_index]->add_index = index;
+	objects_to_add.remove_at_unordered(index);
+
+	p_object->add_index = -1;
+}
+
+void JoltSpace3D::flush_adds() {
+	if (objects_to_add.is_empty()) {
+		return;
+	}
+
+	const int32_t add_count = objects_to_add.size();
+
+	for (const bool activate : {true, false}) {
+		add_ids.clear();
+
+		for (JoltObjectImpl3D* object : objects_to_add) {
+			const JPH::BodyID& jolt_id = object->get_jolt_id();
+
+			// Adding an invalid ID would have Jolt index past the end of its body array
+			if (object->pending_activation == activate && !jolt_id.IsInvalid()) {
+				add_ids.push_back(jolt_id);
+			}
+		}
+
+		_add_bodies(
+			add_ids,
+			activate ? JPH::EActivation::Activate : JPH::EActivation::DontActivate
+		);
+	}
+
+	for (JoltObjectImpl3D* object : objects_to_add) {
+		object->pending_add = false;
+		object->add_index = -1;
+	}
+
+	objects_to_add.clear();
+
+	bodies_added_since_optimizing += add_count;
+
+	if (bodies_added_since_optimizing >= BROAD_PHASE_OPTIMIZATION_THRESHOLD) {
+		physics_system->OptimizeBroadPhase();
+		bodies_added_since_optimizing = 0;
+	}
+}
+
+void JoltSpace3D::enqueue_call_queries(JoltObjectImpl3D* p_object) {
+	if (p_object->query_queued) {
+		return;
+	}
+
+	if (JoltBodyImpl3D* body = p_object->as_body()) {
+		bodies_to_query.push_back(body);
+	} else if (JoltAreaImpl3D* area = p_object->as_area()) {
+		areas_to_query.push_back(area);
+	}
+
+	p_object->query_queued = true;
+}
+
+void JoltSpace3D::dequeue_call_queries(JoltObjectImpl3D* p_object) {
+	if (!p_object->query_queued) {
+		return;
+	}
+
+	if (JoltBodyImpl3D* body = p_object->as_body()) {
+		bodies_to_query.erase(body);
+	} else if (JoltAreaImpl3D* area = p_object->as_area()) {
+		areas_to_query.erase(area);
+	}
+
+	p_object->query_queued = false;
+}
+
 #ifdef GDJ_CONFIG_EDITOR
 
 void JoltSpace3D::dump_debug_snapshot(const String& p_dir) {
@@ -464,42 +757,358 @@ void JoltSpace3D::set_max_debug_contacts(int32_t p_count) {
 
 #endif // GDJ_CONFIG_EDITOR
 
+void JoltSpace3D::_add_bodies(JPH::BodyIDVector& p_body_ids, JPH::EActivation p_activation) {
+	if (p_body_ids.empty()) {
+		return;
+	}
+
+	JPH::BodyInterface& body_iface = get_body_iface();
+
+	const auto body_count = (int)p_body_ids.size();
+
+	const JPH::BodyInterface::AddState add_state =
+		body_iface.AddBodiesPrepare(p_body_ids.data(), body_count);
+
+	body_iface.AddBodiesFinalize(p_body_ids.data(), body_count, add_state, p_activation);
+}
+
+int32_t JoltSpace3D::_calculate_collision_steps(float p_step) const {
+	if (!JoltProjectSettings::use_adaptive_collision_steps()) {
+		return collision_steps;
+	}
+
+	// We add as many collision steps as is needed for the fastest body to not travel further than
+	// the configured distance within a single collision step, bounded by the configured maximum.
+	// Note that the contact listener only keeps the last manifold of each pair across these, so
+	// adding more collision steps won't lead to the same contacts being reported several times.
+	const float max_distance = Math::sqrt(max_speed_sq) * p_step;
+	const float step_distance = JoltProjectSettings::get_adaptive_step_distance();
+	const int32_t max_steps = max(
+		collision_steps,
+		JoltProjectSettings::get_max_adaptive_collision_steps()
+	);
+
+	// The speeds can be arbitrarily large (or even infinite), so we clamp before converting to an
+	// integer, since converting an out-of-range float is undefined behavior. This also catches NaN.
+	const float needed_steps = Math::ceil(max_distance / step_distance);
+
+	if (!(needed_steps < (float)max_steps)) {
+		return max_steps;
+	}
+
+	return max((int32_t)needed_steps, collision_steps);
+}
+
+void JoltSpace3D::_integrate_batch(float p_step) {
+	const JoltTraceScope trace_scope("JoltSpace3D::_integrate_batch");
+
+	const int32_t body_count = batch_bodies.size();
+
+	if (body_count == 0) {
+		return;
+	}
+
+	const int32_t float_count = body_count * 3;
+
+	batch_rids.resize(body_count);
+	batch_positions.resize(float_count);
+	batch_gravities.resize(float_count);
+	batch_linear_velocities.resize(float_count);
+	batch_angular_velocities.resize(float_count);
+	batch_forces.resize(float_count);
+	batch_torques.resize(float_count);
+
+	auto store_vector = [](LocalVector<float>& p_array, int32_t p_index, JPH::Vec3Arg p_vector) {
+		float* values = p_array.ptr() + (ptrdiff_t)p_index * 3;
+		values[0] = p_vector.GetX();
+		values[1] = p_vector.GetY();
+		values[2] = p_vector.GetZ();
+	};
+
+	auto load_vector = [](const LocalVector<float>& p_array, int32_t p_index) {
+		const float* values = p_array.ptr() + (ptrdiff_t)p_index * 3;
+		return JPH::Vec3(values[0], values[1], values[2]);
+	};
+
+	_run_in_batches(body_count, [&](int32_t p_begin, int32_t p_end) {
+		for (int32_t i = p_begin; i < p_end; ++i) {
+			const JPH::Body& jolt_body = *batch_jolt_bodies[i];
+
+			batch_rids[i] = batch_bodies[i]->get_rid().get_id();
+
+			store_vector(batch_positions, i, jolt_body.GetCenterOfMassPosition());
+			store_vector(batch_gravities, i, to_jolt(batch_bodies[i]->get_gravity()));
+			store_vector(batch_linear_velocities, i, jolt_body.GetLinearVelocity());
+			store_vector(batch_angular_velocities, i, jolt_body.GetAngularVelocity());
+			store_vector(batch_forces, i, JPH::Vec3::sZero());
+			store_vector(batch_torques, i, JPH::Vec3::sZero());
+		}
+	});
+
+	auto integrate = [&](int32_t p_begin, int32_t p_end) {
+		JoltBatchIntegration batch = {};
+		batch.bodies = batch_rids.ptr() + p_begin;
+		batch.positions = batch_positions.ptr() + (ptrdiff_t)p_begin * 3;
+		batch.gravities = batch_gravities.ptr() + (ptrdiff_t)p_begin * 3;
+		batch.linear_velocities = batch_linear_velocities.ptr() + (ptrdiff_t)p_begin * 3;
+		batch.angular_velocities = batch_angular_velocities.ptr() + (ptrdiff_t)p_begin * 3;
+		batch.forces = batch_forces.ptr() + (ptrdiff_t)p_begin * 3;
+		batch.torques = batch_torques.ptr() + (ptrdiff_t)p_begin * 3;
+		batch.body_count = p_end - p_begin;
+		batch.step = p_step;
+
+		batch_integrator(&batch, batch_integrator_userdata);
+	};
+
+	if (batch_integrator_parallel) {
+		_run_in_batches(body_count, integrate);
+	} else {
+		integrate(0, body_count);
+	}
+
+	_run_in_batches(body_count, [&](int32_t p_begin, int32_t p_end) {
+		for (int32_t i = p_begin; i < p_end; ++i) {
+			JPH::Body& jolt_body = *batch_jolt_bodies[i];
+			JPH::MotionProperties& motion_properties = *jolt_body.GetMotionPropertiesUnchecked();
+
+			motion_properties.SetLinearVelocityClamped(load_vector(batch_linear_velocities, i));
+			motion_properties.SetAngularVelocityClamped(load_vector(batch_angular_velocities, i));
+
+			jolt_body.AddForce(load_vector(batch_forces, i));
+			jolt_body.AddTorque(load_vector(batch_torques, i));
+		}
+	});
+
+	batch_bodies.clear();
+	batch_jolt_bodies.clear();
+}
+
+void JoltSpace3D::_store_previous_transforms() {
+	// We only track the bodies that are active going into the step, since any other body will have
+	// the same transform before and after it. Bodies that get woken up during the step will have to
+	// wait until the next one.
+	interpolated_ids.clear();
+	physics_system->GetActiveBodies(JPH::EBodyType::RigidBody, interpolated_ids);
+
+	const auto body_count = (int32_t)interpolated_ids.size();
+
+	previous_positions.resize((size_t)body_count);
+	previous_rotations.resize((size_t)body_count);
+
+	body_accessor.acquire(interpolated_ids.data(), body_count);
+
+	for (int32_t i = 0; i < body_count; ++i) {
+		if (const JPH::Body* jolt_body = body_accessor.try_get(i)) {
+			previous_positions[(size_t)i] = jolt_body->GetPosition();
+			previous_rotations[(size_t)i] = jolt_body->GetRotation();
+		}
+	}
+
+	body_accessor.release();
+}
+
+void JoltSpace3D::_store_current_transforms() {
+	const auto id_count = (int32_t)interpolated_ids.size();
+
+	current_positions.resize((size_t)id_count);
+	current_rotations.resize((size_t)id_count);
+	interpolated_scales.resize((size_t)id_count);
+	interpolated_rids.resize(id_count);
+
+	body_accessor.acquire(interpolated_ids.data(), id_count);
+
+	int32_t body_count = 0;
+
+	for (int32_t i = 0; i < id_count; ++i) {
+		const JPH::Body* jolt_body = body_accessor.try_get(i);
+
+		if (jolt_body == nullptr || jolt_body->IsSensor()) {
+			continue;
+		}
+
+		const auto* body = reinterpret_cast<const JoltBodyImpl3D*>(jolt_body->GetUserData());
+
+		// Compact the buffers as we go, since we skip over areas
+		const auto index = (size_t)body_count++;
+
+		previous_positions[index] = previous_positions[(size_t)i];
+		previous_rotations[index] = previous_rotations[(size_t)i];
+		current_positions[index] = jolt_body->GetPosition();
+		current_rotations[index] = jolt_body->GetRotation();
+		interpolated_scales[index] = to_jolt(body->get_scale());
+		interpolated_rids[(uint32_t)index] = body->get_rid().get_id();
+	}
+
+	body_accessor.release();
+
+	previous_positions.resize((size_t)body_count);
+	previous_rotations.resize((size_t)body_count);
+	current_positions.resize((size_t)body_count);
+	current_rotations.resize((size_t)body_count);
+	interpolated_scales.resize((size_t)body_count);
+	interpolated_rids.resize(body_count);
+}
+
+template<typename TCallback>
+void JoltSpace3D::_run_in_batches(int32_t p_count, const TCallback& p_callback) {
+	const int32_t batch_count = min(
+		(p_count + STEP_BATCH_SIZE - 1) / STEP_BATCH_SIZE,
+		(int32_t)job_system->GetMaxConcurrency()
+	);
+
+	if (batch_count <= 1) {
+		p_callback(0, p_count);
+		return;
+	}
+
+	const int32_t batch_size = (p_count + batch_count - 1) / batch_count;
+
+	JPH::JobSystem::Barrier* barrier = job_system->CreateBarrier();
+
+	for (int32_t i = 0; i < batch_count; ++i) {
+		const int32_t begin = i * batch_size;
+		const int32_t end = min(begin + batch_size, p_count);
+
+		const JPH::JobHandle job = job_system->CreateJob(
+			"JoltStepObjects",
+			JPH::Color::sGrey,
+			[&p_callback, begin, end]() { p_callback(begin, end); }
+		);
+
+		barrier->AddJob(job);
+	}
+
+	job_system->WaitForJobs(barrier);
+	job_system->DestroyBarrier(barrier);
+}
+
 void JoltSpace3D::_pre_step(float p_step) {
-	body_accessor.acquire_all(true);
+	const JoltTraceScope trace_scope("JoltSpace3D::_pre_step");
 
 	contact_listener->pre_step();
 
-	const int32_t body_count = body_accessor.get_count();
+	// Any bodies inside of an area will need that area's gravity, which for point gravity means
+	// reading the area's transform, so we do that once per area here rather than once per body.
+	for (JoltAreaImpl3D* area : areas) {
+		area->cache_gravity();
+	}
+
+	// Only active bodies and the objects that have explicitly asked to be stepped (such as
+	// kinematic bodies, which need to be moved even while sleeping) have anything to do here, so we
+	// avoid visiting (and locking) the potentially large amount of sleeping or static bodies.
+	physics_system->GetActiveBodies(JPH::EBodyType::RigidBody, step_ids);
+
+	const auto active_count = (int32_t)step_ids.size();
+
+	for (const JoltObjectImpl3D* object : stepping_objects) {
+		step_ids.push_back(object->get_jolt_id());
+	}
+
+	const auto step_count = (int32_t)step_ids.size();
+
+	body_accessor.acquire(step_ids.data(), step_count, true);
+
+	// Since the objects are stepped in parallel we can't go through `enqueue_call_queries` when a
+	// body ends up needing its queries called, so we instead reserve enough room for all of them up
+	// front and let the batches claim slots atomically.
+	const int32_t queued_count = bodies_to_query.size();
+	bodies_to_query.resize(queued_count + step_count);
+	std::atomic<int32_t> next_query_index = queued_count;
+
+	const bool integrate_batch = batch_integrator != nullptr;
+
+	if (integrate_batch) {
+		batch_bodies.resize(step_count);
+		batch_jolt_bodies.resize(step_count);
+	}
+
+	std::atomic<int32_t> next_batch_index = 0;
+
+	const bool track_speed = JoltProjectSettings::use_adaptive_collision_steps();
+	std::atomic<float> shared_max_speed_sq = 0.0f;
+
+	_run_in_batches(step_count, [&](int32_t p_begin, int32_t p_end) {
+		float batch_max_speed_sq = 0.0f;
+
+		for (int32_t i = p_begin; i < p_end; ++i) {
+			JPH::Body* jolt_body = body_accessor.try_get(i);
+
+			if (jolt_body == nullptr) {
+				continue;
+			}
 
-	for (int32_t i = 0; i < body_count; ++i) {
-		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
 			auto* object = reinterpret_cast<JoltObjectImpl3D*>(jolt_body->GetUserData());
 
+			// Active objects that are also in the list of stepping objects will be stepped as part
+			// of that list instead, to avoid stepping them twice.
+			if (i < active_count && (!object->is_body() || object->is_stepping())) {
+				continue;
+			}
+
 			object->pre_step(p_step, *jolt_body);
 
-			if (object->generates_contacts()) {
-				contact_listener->listen_for(object);
+			JoltBodyImpl3D* body = object->as_body();
+
+			if (body != nullptr && !body->query_queued && body->needs_call_queries()) {
+				body->query_queued = true;
+				bodies_to_query[next_query_index++] = body;
+			}
+
+			if (integrate_batch && body != nullptr && body->is_batch_integrated() &&
+				body->is_rigid() && jolt_body->IsActive())
+			{
+				const int32_t batch_index = next_batch_index++;
+				batch_bodies[batch_index] = body;
+				batch_jolt_bodies[batch_index] = jolt_body;
+			}
+
+			if (track_speed && !jolt_body->IsStatic()) {
+				const float speed_sq = jolt_body->GetLinearVelocity().LengthSq();
+				batch_max_speed_sq = max(batch_max_speed_sq, speed_sq);
 			}
 		}
+
+		atomic_max(shared_max_speed_sq, batch_max_speed_sq);
+	});
+
+	bodies_to_query.resize(next_query_index);
+
+	max_speed_sq = shared_max_speed_sq;
+
+	if (integrate_batch) {
+		batch_bodies.resize(next_batch_index);
+		batch_jolt_bodies.resize(next_batch_index);
+
+		_integrate_batch(p_step);
 	}
 
 	body_accessor.release();
 }
 
 void JoltSpace3D::_post_step(float p_step) {
-	body_accessor.acquire_all(true);
+	const JoltTraceScope trace_scope("JoltSpace3D::_post_step");
+
+	step_ids.clear();
 
-	contact_listener->post_step();
+	for (const JoltObjectImpl3D* object : shape_swapped_objects) {
+		step_ids.push_back(object->get_jolt_id());
+	}
 
-	const int32_t body_count = body_accessor.get_count();
+	const auto step_count = (int32_t)step_ids.size();
 
-	for (int32_t i = 0; i < body_count; ++i) {
-		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			auto* object = reinterpret_cast<JoltObjectImpl3D*>(jolt_body->GetUserData());
+	body_accessor.acquire(step_ids.data(), step_count, true);
 
-			object->post_step(p_step, *jolt_body);
+	contact_listener->post_step(step_ids.data(), step_count);
+
+	_run_in_batches(step_count, [&](int32_t p_begin, int32_t p_end) {
+		for (int32_t i = p_begin; i < p_end; ++i) {
+			if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
+				shape_swapped_objects[i]->post_step(p_step, *jolt_body);
+			}
 		}
-	}
+	});
+
+	shape_swapped_objects.clear();
 
 	body_accessor.release();
 }
@@ -1,16 +1,23 @@
 #pragma once
 
+#include "spaces/jolt_batch_integrator.hpp"
 #include "spaces/jolt_body_accessor_3d.hpp"
+#include "spaces/jolt_contact_listener_3d.hpp"
 
 class JoltAreaImpl3D;
-class JoltContactListener3D;
+class JoltBodyImpl3D;
 class JoltJointImpl3D;
 class JoltLayerMapper;
 class JoltObjectImpl3D;
 class JoltPhysicsDirectSpaceState3D;
+class JoltTempAllocator;
 
 class JoltSpace3D final {
 public:
+	// The packed state of a body consists of its transform, followed by its linear and angular
+	// velocity.
+	static constexpr int32_t PACKED_BODY_STATE_SIZE = PACKED_TRANSFORM_SIZE + 3 + 3;
+
 	explicit JoltSpace3D(JPH::JobSystem* p_job_system);
 
 	~JoltSpace3D();
@@ -74,12 +81,40 @@ public:
 
 	JoltPhysicsDirectSpaceState3D* get_direct_state();
 
+	int32_t get_active_body_states(PackedInt64Array& p_rids, PackedFloat32Array& p_states);
+
+	bool is_interpolation_enabled() const { return interpolation_enabled; }
+
+	void set_interpolation_enabled(bool p_enabled);
+
+	int32_t interpolate_into(
+		float p_alpha,
+		PackedInt64Array& p_rids,
+		PackedFloat32Array& p_transforms
+	) const;
+
+	bool is_contact_stream_enabled() const;
+
+	void set_contact_stream_enabled(bool p_enabled);
+
+	const JoltContactListener3D::ContactStream& get_contact_stream() const;
+
+	bool has_batch_integrator() const { return batch_integrator != nullptr; }
+
+	void set_batch_integrator(JoltBatchIntegrator p_integrator, void* p_userdata, bool p_parallel);
+
 	void set_default_area(JoltAreaImpl3D* p_area) { default_area = p_area; }
 
 	JoltAreaImpl3D* get_default_area() const { return default_area; }
 
 	float get_last_step() const { return last_step; }
 
+	int32_t get_collision_steps() const { return collision_steps; }
+
+	const JoltTempAllocator& get_temp_allocator() const { return *temp_allocator; }
+
+	void set_collision_steps(int32_t p_steps) { collision_steps = p_steps; }
+
 	void add_joint(JPH::Constraint* p_jolt_ref);
 
 	void add_joint(JoltJointImpl3D* p_joint);
@@ -88,6 +123,32 @@ public:
 
 	void remove_joint(JoltJointImpl3D* p_joint);
 
+	void add_area(JoltAreaImpl3D* p_area);
+
+	void remove_area(JoltAreaImpl3D* p_area);
+
+	void add_stepping_object(JoltObjectImpl3D* p_object);
+
+	void remove_stepping_object(JoltObjectImpl3D* p_object);
+
+	void listen_for_contacts(const JoltObjectImpl3D* p_object);
+
+	void stop_listening_for_contacts(const JoltObjectImpl3D* p_object);
+
+	void enqueue_shape_swap(JoltObjectImpl3D* p_object);
+
+	void dequeue_shape_swap(JoltObjectImpl3D* p_object);
+
+	void enqueue_add(JoltObjectImpl3D* p_object);
+
+	void dequeue_add(JoltObjectImpl3D* p_object);
+
+	void flush_adds();
+
+	void enqueue_call_queries(JoltObjectImpl3D* p_object);
+
+	void dequeue_call_queries(JoltObjectImpl3D* p_object);
+
 #ifdef GDJ_CONFIG_EDITOR
 	void dump_debug_snapshot(const String& p_dir);
 
@@ -105,13 +166,76 @@ private:
 
 	void _post_step(float p_step);
 
+	int32_t _calculate_collision_steps(float p_step) const;
+
+	void _integrate_batch(float p_step);
+
+	void _store_previous_transforms();
+
+	void _store_current_transforms();
+
+	void _add_bodies(JPH::BodyIDVector& p_body_ids, JPH::EActivation p_activation);
+
+	template<typename TCallback>
+	void _run_in_batches(int32_t p_count, const TCallback& p_callback);
+
 	JoltBodyWriter3D body_accessor;
 
+	LocalVector<JoltObjectImpl3D*> stepping_objects;
+
+	LocalVector<JoltAreaImpl3D*> areas;
+
+	LocalVector<JoltObjectImpl3D*> shape_swapped_objects;
+
+	LocalVector<JoltObjectImpl3D*> objects_to_add;
+
+	LocalVector<JoltBodyImpl3D*> bodies_to_query;
+
+	LocalVector<JoltAreaImpl3D*> areas_to_query;
+
+	LocalVector<JoltBodyImpl3D*> batch_bodies;
+
+	LocalVector<JPH::Body*> batch_jolt_bodies;
+
+	LocalVector<int64_t> batch_rids;
+
+	LocalVector<float> batch_positions;
+
+	LocalVector<float> batch_gravities;
+
+	LocalVector<float> batch_linear_velocities;
+
+	LocalVector<float> batch_angular_velocities;
+
+	LocalVector<float> batch_forces;
+
+	LocalVector<float> batch_torques;
+
+	JPH::BodyIDVector step_ids;
+
+	JPH::BodyIDVector query_ids;
+
+	JPH::BodyIDVector add_ids;
+
+	JPH::BodyIDVector interpolated_ids;
+
+	JPH::Array<JPH::Vec3> previous_positions;
+
+	JPH::Array<JPH::Vec3> current_positions;
+
+	JPH::Array<JPH::Quat> previous_rotations;
+
+	JPH::Array<JPH::Quat> current_rotations;
+
+	JPH::Array<JPH::Vec3> interpolated_scales;
+
+	LocalVector<int64_t> interpolated_rids;
+
 	RID rid;
 
 	JPH::JobSystem* job_system = nullptr;
 
-	JPH::TempAllocator* temp_allocator = nullptr;
+	JoltTempAllocator* temp_allocator = nullptr;
 
 	JoltLayerMapper* layer_mapper = nullptr;
 
@@ -123,7 +247,21 @@ private:
 
 	JoltAreaImpl3D* default_area = nullptr;
 
+	JoltBatchIntegrator batch_integrator = nullptr;
+
+	void* batch_integrator_userdata = nullptr;
+
 	float last_step = 0.0f;
 
+	float max_speed_sq = 0.0f;
+
+	int32_t collision_steps = 1;
+
+	int32_t bodies_added_since_optimizing = 0;
+
 	bool has_stepped = false;
+
+	bool interpolation_enabled = false;
+
+	bool batch_integrator_parallel = false;
 };
@@ -2,12 +2,22 @@
 
 #include "servers/jolt_project_settings.hpp"
 
+namespace {
+
+// How much room to leave on top of the peak usage when growing the primary chunk
+constexpr uint64_t GROWTH_HEADROOM_PERCENT = 25;
+
+} // namespace
+
 JoltTempAllocator::JoltTempAllocator()
-	: capacity((uint64_t)JoltProjectSettings::get_max_temp_memory_b())
-	, base(static_cast<uint8_t*>(JPH::Allocate((size_t)capacity))) { }
+	: min_capacity((uint64_t)JoltProjectSettings::get_max_temp_memory_b()) {
+	chunks.push_back(_allocate_chunk(min_capacity));
+}
 
 JoltTempAllocator::~JoltTempAllocator() {
-	JPH::Free(base);
+	for (Chunk& chunk : chunks) {
+		_free_chunk(chunk);
+	}
 }
 
 void* JoltTempAllocator::Allocate(uint32_t p_size) {
@@ -17,24 +27,32 @@ void* JoltTempAllocator::Allocate(uint32_t p_size) {
 
 	p_size = align_up(p_size, 16U);
 
-	const uint64_t new_top = top + p_size;
+	Chunk* chunk = &chunks[current_chunk];
 
-	void* ptr = nullptr;
+	if (chunk->top + p_size > chunk->capacity) {
+		// Any chunks past the current one are guaranteed to be empty, so we can move on to the next
+		// one (or replace it if it's too small) without having to worry about what's in it
+		const int32_t next_chunk = current_chunk + 1;
 
-	if (new_top <= capacity) {
-		ptr = base + top;
-	} else {
-		WARN_PRINT_ONCE(vformat(
-			"Godot Jolt's temporary memory allocator exceeded capacity of %d MiB. "
-			"Falling back to slower general-purpose allocator. "
-			"Consider increasing maximum temporary memory in project settings.",
-			JoltProjectSettings::get_max_temp_memory_mib()
-		));
+		if (next_chunk == (int32_t)chunks.size()) {
+			chunks.push_back(_allocate_chunk(max(chunks[0].capacity / 2, (uint64_t)p_size)));
+			overflow_count++;
+		} else if (chunks[next_chunk].capacity < p_size) {
+			_free_chunk(chunks[next_chunk]);
+			chunks[next_chunk] = _allocate_chunk(max(chunks[0].capacity / 2, (uint64_t)p_size));
+			overflow_count++;
+		}
 
-		ptr = JPH::Allocate(p_size);
+		current_chunk = next_chunk;
+		chunk = &chunks[current_chunk];
 	}
 
-	top = new_top;
+	void* ptr = chunk->base + chunk->top;
+
+	chunk->top += p_size;
+
+	usage += p_size;
+	peak_usage = max(peak_usage, usage);
 
 	return ptr;
 }
@@ -46,15 +64,64 @@ void JoltTempAllocator::Free(void* p_ptr, uint32_t p_size) {
 
 	p_size = align_up(p_size, 16U);
 
-	const uint64_t new_top = top - p_size;
+	Chunk& chunk = chunks[current_chunk];
 
-	if (top <= capacity) {
-		if (base + new_top != p_ptr) {
-			CRASH_NOW_MSG("Temporary memory was freed in the wrong order.");
-		}
-	} else {
-		JPH::Free(p_ptr);
+	chunk.top -= p_size;
+
+	if (chunk.base + chunk.top != p_ptr) {
+		CRASH_NOW_MSG("Temporary memory was freed in the wrong order.");
+	}
+
+	usage -= p_size;
+
+	if (chunk.top == 0 && current_chunk > 0) {
+		current_chunk--;
+	}
+}
+
+void JoltTempAllocator::post_step() {
+	ERR_FAIL_COND_MSG(usage != 0, "Temporary memory was not freed by the end of the step.");
+
+	last_peak_usage = peak_usage;
+	peak_usage = 0;
+
+	// We resize the primary chunk towards whatever the step actually needed, so that future steps
+	// can stay within a single chunk, but we never go below what's set in the project settings.
+	// Growing happens all at once, while shrinking happens gradually, to avoid having to grow again
+	// right after a quiet step or two.
+	const uint64_t headroom = last_peak_usage * GROWTH_HEADROOM_PERCENT / 100;
+	const uint64_t target_capacity = max(align_up(last_peak_usage + headroom, 16ULL), min_capacity);
+
+	const uint64_t capacity = chunks[0].capacity;
+
+	uint64_t new_capacity = capacity;
+
+	if (target_capacity > capacity) {
+		new_capacity = target_capacity;
+	} else if (target_capacity < capacity / 2) {
+		new_capacity = max(align_up(capacity / 2, 16ULL), min_capacity);
 	}
 
-	top = new_top;
+	if (new_capacity == capacity && chunks.size() == 1) {
+		return;
+	}
+
+	for (Chunk& chunk : chunks) {
+		_free_chunk(chunk);
+	}
+
+	chunks.clear();
+	chunks.push_back(_allocate_chunk(new_capacity));
+}
+
+JoltTempAllocator::Chunk JoltTempAllocator::_allocate_chunk(uint64_t p_capacity) {
+	Chunk chunk;
+	chunk.base = static_cast<uint8_t*>(JPH::Allocate((size_t)p_capacity));
+	chunk.capacity = p_capacity;
+	return chunk;
+}
+
+void JoltTempAllocator::_free_chunk(Chunk& p_chunk) {
+	JPH::Free(p_chunk.base);
+	p_chunk = {};
 }
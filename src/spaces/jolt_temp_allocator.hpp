@@ -10,10 +10,38 @@ public:
 
 	void Free(void* p_ptr, uint32_t p_size) override;
 
+	void post_step();
+
+	uint64_t get_capacity() const { return chunks[0].capacity; }
+
+	uint64_t get_peak_usage() const { return last_peak_usage; }
+
+	int64_t get_overflow_count() const { return overflow_count; }
+
 private:
-	uint64_t capacity = 0;
+	struct Chunk {
+		uint8_t* base = nullptr;
+
+		uint64_t capacity = 0;
+
+		uint64_t top = 0;
+	};
+
+	static Chunk _allocate_chunk(uint64_t p_capacity);
+
+	static void _free_chunk(Chunk& p_chunk);
+
+	LocalVector<Chunk> chunks;
+
+	uint64_t min_capacity = 0;
+
+	uint64_t usage = 0;
+
+	uint64_t peak_usage = 0;
+
+	uint64_t last_peak_usage = 0;
 
-	uint64_t top = 0;
+	int64_t overflow_count = 0;
 
-	uint8_t* base = nullptr;
+	int32_t current_chunk = 0;
 };
@@ -0,0 +1,205 @@
+#include "jolt_thread_pool.hpp"
+
+namespace {
+
+// Roughly how many times an idle worker will check for new work before parking itself, which should
+// be enough to cover the gaps between the various jobs that make up a physics step
+constexpr int32_t SPIN_COUNT = 4096;
+
+} // namespace
+
+JoltThreadPool::JoltThreadPool(int32_t p_thread_count, int32_t p_capacity) {
+	// The capacity is rounded up to a power of two, so that we can wrap the indices with a mask
+	uint32_t slot_count = 1;
+
+	while (slot_count < (uint32_t)p_capacity) {
+		slot_count <<= 1;
+	}
+
+	slot_mask = slot_count - 1;
+
+	workers.resize(p_thread_count);
+
+	for (Worker*& worker : workers) {
+		worker = new Worker();
+		worker->slots = new Slot[slot_count];
+
+		for (uint32_t i = 0; i < slot_count; ++i) {
+			worker->slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	for (int32_t i = 0; i < p_thread_count; ++i) {
+		workers[i]->thread = std::thread(&JoltThreadPool::_run, this, i);
+	}
+}
+
+JoltThreadPool::~JoltThreadPool() {
+	{
+		const std::lock_guard park_lock(park_mutex);
+		stopping = true;
+	}
+
+	park_condition.notify_all();
+
+	for (Worker* worker : workers) {
+		worker->thread.join();
+		delete[] worker->slots;
+		delete worker;
+	}
+}
+
+void JoltThreadPool::submit(Task p_task, void* p_user_data) {
+	// Work submitted from one of our own workers goes onto that worker's own queue, where it will
+	// most likely end up being picked up by that same worker, while anything else gets spread out
+	// evenly across all the workers.
+	const int32_t worker_count = workers.size();
+
+	const int32_t worker_index = current_pool == this
+		? current_index
+		: (int32_t)(next_worker++ % (uint32_t)worker_count);
+
+	const Entry entry = {p_task, p_user_data};
+
+	bool pushed = false;
+
+	for (int32_t i = 0; i < worker_count && !pushed; ++i) {
+		pushed = _push_entry(*workers[(worker_index + i) % worker_count], slot_mask, entry);
+	}
+
+	if (!pushed) {
+		// Every queue is sized to fit all the jobs that the job system can have in flight, so this
+		// shouldn't happen, but if it does we're better off running the task here than dropping it
+		p_task(p_user_data);
+		return;
+	}
+
+	++pending_count;
+
+	if (parked_count > 0) {
+		// Taking the lock here makes sure that we don't slip in between a worker checking for work
+		// and it actually parking itself, which would leave it asleep with work pending
+		{ const std::lock_guard park_lock(park_mutex); }
+
+		park_condition.notify_one();
+	}
+}
+
+void JoltThreadPool::_run(int32_t p_index) {
+	current_pool = this;
+	current_index = p_index;
+
+	Entry entry;
+
+	while (true) {
+		if (_try_pop(p_index, entry) || _try_steal(p_index, entry)) {
+			--pending_count;
+			entry.task(entry.user_data);
+			continue;
+		}
+
+		if (stopping) {
+			break;
+		}
+
+		if (!_spin()) {
+			_park();
+		}
+	}
+}
+
+bool JoltThreadPool::_push_entry(Worker& p_worker, uint32_t p_mask, const Entry& p_entry) {
+	// Each slot's sequence tells us whose turn it is to use it, where a sequence equal to the index
+	// means the slot is free to push to, and one past the index means it's ready to be popped
+	uint32_t index = p_worker.push_index.load(std::memory_order_relaxed);
+	Slot* slot = nullptr;
+
+	while (true) {
+		slot = &p_worker.slots[index & p_mask];
+
+		const uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+		const auto difference = (int32_t)(sequence - index);
+
+		if (difference == 0) {
+			if (p_worker.push_index.compare_exchange_weak(index, index + 1)) {
+				break;
+			}
+		} else if (difference < 0) {
+			return false;
+		} else {
+			index = p_worker.push_index.load(std::memory_order_relaxed);
+		}
+	}
+
+	slot->entry = p_entry;
+	slot->sequence.store(index + 1, std::memory_order_release);
+
+	return true;
+}
+
+bool JoltThreadPool::_pop_entry(Worker& p_worker, uint32_t p_mask, Entry& p_entry) {
+	uint32_t index = p_worker.pop_index.load(std::memory_order_relaxed);
+	Slot* slot = nullptr;
+
+	while (true) {
+		slot = &p_worker.slots[index & p_mask];
+
+		const uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+		const auto difference = (int32_t)(sequence - (index + 1));
+
+		if (difference == 0) {
+			if (p_worker.pop_index.compare_exchange_weak(index, index + 1)) {
+				break;
+			}
+		} else if (difference < 0) {
+			return false;
+		} else {
+			index = p_worker.pop_index.load(std::memory_order_relaxed);
+		}
+	}
+
+	p_entry = slot->entry;
+
+	// This hands the slot back to whoever pushes to it the next time around the buffer
+	slot->sequence.store(index + p_mask + 1, std::memory_order_release);
+
+	return true;
+}
+
+bool JoltThreadPool::_try_pop(int32_t p_index, Entry& p_entry) {
+	return _pop_entry(*workers[p_index], slot_mask, p_entry);
+}
+
+bool JoltThreadPool::_try_steal(int32_t p_index, Entry& p_entry) {
+	const int32_t worker_count = workers.size();
+
+	for (int32_t i = 1; i < worker_count; ++i) {
+		if (_pop_entry(*workers[(p_index + i) % worker_count], slot_mask, p_entry)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool JoltThreadPool::_spin() {
+	for (int32_t i = 0; i < SPIN_COUNT; ++i) {
+		if (pending_count > 0 || stopping) {
+			return true;
+		}
+
+		std::this_thread::yield();
+	}
+
+	return false;
+}
+
+void JoltThreadPool::_park() {
+	std::unique_lock park_lock(park_mutex);
+
+	++parked_count;
+
+	park_condition.wait(park_lock, [this] { return pending_count > 0 || stopping; });
+
+	--parked_count;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+class JoltThreadPool final {
+public:
+	using Task = void (*)(void* p_user_data);
+
+	JoltThreadPool(int32_t p_thread_count, int32_t p_capacity);
+
+	JoltThreadPool(const JoltThreadPool& p_other) = delete;
+
+	JoltThreadPool(JoltThreadPool&& p_other) = delete;
+
+	~JoltThreadPool();
+
+	int32_t get_thread_count() const { return workers.size(); }
+
+	void submit(Task p_task, void* p_user_data);
+
+	JoltThreadPool& operator=(const JoltThreadPool& p_other) = delete;
+
+	JoltThreadPool& operator=(JoltThreadPool&& p_other) = delete;
+
+private:
+	struct Entry {
+		Task task = nullptr;
+
+		void* user_data = nullptr;
+	};
+
+	struct Slot {
+		Entry entry;
+
+		std::atomic<uint32_t> sequence = 0;
+	};
+
+	// Each worker has a fixed-capacity ring buffer that any thread can push to or pop from without
+	// locking or allocating, which means the oldest entries get popped first, even by the owner.
+	struct Worker {
+		std::thread thread;
+
+		Slot* slots = nullptr;
+
+		alignas(JPH_CACHE_LINE_SIZE) std::atomic<uint32_t> push_index = 0;
+
+		alignas(JPH_CACHE_LINE_SIZE) std::atomic<uint32_t> pop_index = 0;
+	};
+
+	void _run(int32_t p_index);
+
+	static bool _push_entry(Worker& p_worker, uint32_t p_mask, const Entry& p_entry);
+
+	static bool _pop_entry(Worker& p_worker, uint32_t p_mask, Entry& p_entry);
+
+	bool _try_pop(int32_t p_index, Entry& p_entry);
+
+	bool _try_steal(int32_t p_index, Entry& p_entry);
+
+	bool _spin();
+
+	void _park();
+
+	inline static thread_local JoltThreadPool* current_pool = nullptr;
+
+	inline static thread_local int32_t current_index = -1;
+
+	LocalVector<Worker*> workers;
+
+	std::mutex park_mutex;
+
+	std::condition_variable park_condition;
+
+	std::atomic<int32_t> pending_count = 0;
+
+	std::atomic<int32_t> parked_count = 0;
+
+	std::atomic<uint32_t> next_worker = 0;
+
+	uint32_t slot_mask = 0;
+
+	std::atomic<bool> stopping = false;
+};